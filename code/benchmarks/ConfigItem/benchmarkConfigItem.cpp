@@ -0,0 +1,232 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains benchmarks for ConfigItem class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+#include "BenchmarkRunner.hpp"
+#include "GeneratedConfig.hpp"
+
+// Qt includes
+#include <QtCore/QCoreApplication>
+#include <QtCore/QMap>
+#include <QtCore/QVector>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFrameworkBenchmark;
+using namespace CppConfigFrameworkTools;
+
+// Benchmark config classes ------------------------------------------------------------------------
+
+//! Configuration structure for the last Object node level of the generated configuration
+class LeafConfig : public ConfigItem
+{
+public:
+    LeafConfig(const int width = 0)
+        : values(width, 0)
+    {
+    }
+
+    QVector<int> values;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        for (int i = 0; i < values.size(); i++)
+        {
+            if (!loadRequiredConfigParameter(&values[i], QString("value_%1").arg(i), config))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        for (int i = 0; i < values.size(); i++)
+        {
+            if (!storeConfigParameter(values.at(i), QString("value_%1").arg(i), config))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Configuration structure for an intermediate Object node level of the generated configuration
+class BranchConfig : public ConfigItem
+{
+public:
+    BranchConfig(const int width = 0)
+        : width(width)
+    {
+    }
+
+    int width;
+    QMap<QString, LeafConfig> nodes;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        const int leafWidth = width;
+
+        return loadRequiredConfigContainer(&nodes,
+                                           "nodes",
+                                           config,
+                                           [leafWidth](const QString &)
+                                           {
+                                               return LeafConfig(leafWidth);
+                                           });
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigContainer(nodes, "nodes", config);
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Configuration structure for the root Object node of the generated configuration
+class RootConfig : public ConfigItem
+{
+public:
+    RootConfig(const int width = 0)
+        : width(width)
+    {
+    }
+
+    int width;
+    QMap<QString, BranchConfig> nodes;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        const int branchWidth = width;
+
+        return loadRequiredConfigContainer(&nodes,
+                                           "nodes",
+                                           config,
+                                           [branchWidth](const QString &)
+                                           {
+                                               return BranchConfig(branchWidth);
+                                           });
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigContainer(nodes, "nodes", config);
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Wraps all Object nodes of the generated configuration in a "nodes" member so that the levels can
+ * be loaded as configuration containers
+ *
+ * \param   node    Object node of the generated configuration
+ *
+ * \return  Wrapped configuration node
+ */
+static std::unique_ptr<ConfigObjectNode> wrapContainers(const ConfigObjectNode &node)
+{
+    auto wrapped = std::make_unique<ConfigObjectNode>();
+    auto nodes = std::make_unique<ConfigObjectNode>();
+
+    for (const QString &name : node.names())
+    {
+        const auto *member = node.member(name);
+
+        if (member->isObject())
+        {
+            nodes->setMember(name, wrapContainers(member->toObject()));
+        }
+        else
+        {
+            wrapped->setMember(name, *member);
+        }
+    }
+
+    if (nodes->count() > 0)
+    {
+        wrapped->setMember(QStringLiteral("nodes"), std::move(nodes));
+    }
+
+    return wrapped;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    BenchmarkRunner runner(QStringLiteral("ConfigItem"), app.arguments());
+
+    if (!runner.isValid())
+    {
+        return runner.finish();
+    }
+
+    for (const int width : { 4, 8, 16, 32 })
+    {
+        ConfigGeneratorParameters parameters;
+        parameters.members = width;
+        parameters.depth = 2;
+        parameters.integerValues = true;
+
+        const auto config = wrapContainers(
+                *createConfigNode(ConfigGenerator(parameters).generateTree()));
+
+        runner.run(QStringLiteral("LoadConfig"), parameters.toJson(), [&]()
+        {
+            RootConfig rootConfig(width);
+            const bool result = rootConfig.loadConfig(*config);
+            Q_ASSERT(result);
+            Q_UNUSED(result);
+        });
+
+        RootConfig loadedConfig(width);
+        loadedConfig.loadConfig(*config);
+
+        runner.run(QStringLiteral("StoreConfig"), parameters.toJson(), [&]()
+        {
+            ConfigObjectNode storedConfig;
+            const bool result = loadedConfig.storeConfig(&storedConfig);
+            Q_ASSERT(result);
+            Q_UNUSED(result);
+        });
+    }
+
+    return runner.finish();
+}
@@ -0,0 +1,263 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains benchmarks for ConfigNode classes
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include "BenchmarkRunner.hpp"
+#include "GeneratedConfig.hpp"
+
+// Qt includes
+#include <QtCore/QCoreApplication>
+
+// System includes
+#include <map>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFrameworkBenchmark;
+using namespace CppConfigFrameworkTools;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks applying of a configuration node to another configuration node (copied and moved, to
+ * a node with the same structure and to an empty node)
+ *
+ * \param   parameters  Parameters of the generated configuration
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkApply(const ConfigGeneratorParameters &parameters, BenchmarkRunner *runner)
+{
+    const QJsonObject tree = ConfigGenerator(parameters).generateTree();
+    const auto source = createConfigNode(tree);
+    std::unique_ptr<ConfigObjectNode> movedSource;
+    std::unique_ptr<ConfigObjectNode> destination;
+
+    auto setup = [&]()
+    {
+        destination = createConfigNode(tree);
+    };
+
+    auto setupMove = [&]()
+    {
+        destination = createConfigNode(tree);
+        movedSource = createConfigNode(tree);
+    };
+
+    auto setupEmpty = [&]()
+    {
+        destination = std::make_unique<ConfigObjectNode>();
+    };
+
+    auto setupMoveEmpty = [&]()
+    {
+        destination = std::make_unique<ConfigObjectNode>();
+        movedSource = createConfigNode(tree);
+    };
+
+    runner->run(QStringLiteral("Apply"), parameters.toJson(), setup, [&]()
+    {
+        destination->apply(*source);
+    });
+
+    runner->run(QStringLiteral("ApplyMove"), parameters.toJson(), setupMove, [&]()
+    {
+        destination->apply(std::move(*movedSource));
+    });
+
+    runner->run(QStringLiteral("ApplyToEmpty"), parameters.toJson(), setupEmpty, [&]()
+    {
+        destination->apply(*source);
+    });
+
+    runner->run(QStringLiteral("ApplyMoveToEmpty"), parameters.toJson(), setupMoveEmpty, [&]()
+    {
+        destination->apply(std::move(*movedSource));
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks cloning of a configuration node
+ *
+ * \param   parameters  Parameters of the generated configuration
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkClone(const ConfigGeneratorParameters &parameters, BenchmarkRunner *runner)
+{
+    const QJsonObject tree = ConfigGenerator(parameters).generateTree();
+    const auto source = createConfigNode(tree);
+
+    runner->run(QStringLiteral("Clone"), parameters.toJson(), [&]()
+    {
+        auto clone = source->clone();
+        Q_ASSERT(clone);
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks node lookup by node path and node path creation
+ *
+ * \param   parameters  Parameters of the generated configuration
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkNodeAtPath(const ConfigGeneratorParameters &parameters,
+                                BenchmarkRunner *runner)
+{
+    ConfigGenerator generator(parameters);
+    const auto config = createConfigNode(generator.generateTree());
+    const QStringList paths = generator.valuePaths();
+
+    runner->run(QStringLiteral("NodeAtPath"), parameters.toJson(), [&]()
+    {
+        for (const QString &path : paths)
+        {
+            const auto *node = config->nodeAtPath(path);
+            Q_ASSERT(node != nullptr);
+            Q_UNUSED(node);
+        }
+    });
+
+    runner->run(QStringLiteral("NodePath"), parameters.toJson(), [&]()
+    {
+        for (const QString &path : paths)
+        {
+            const auto nodePath = config->nodeAtPath(path)->nodePath();
+            Q_ASSERT(nodePath.path() == path);
+            Q_UNUSED(nodePath);
+        }
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks member lookup and insertion in an Object node and compares them to the same
+ * operations on a tree based map (the previous member storage)
+ *
+ * \param   memberCount     Number of members in the Object node
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkMembers(const int memberCount, BenchmarkRunner *runner)
+{
+    QJsonObject parameters;
+    parameters[QStringLiteral("members")] = memberCount;
+
+    // Insert the members in reverse order to exercise insertion in the middle of the container
+    QStringList names;
+
+    for (int i = memberCount - 1; i >= 0; i--)
+    {
+        names.append(QStringLiteral("member_%1").arg(i));
+    }
+
+    ConfigObjectNode object;
+    std::map<QString, std::unique_ptr<ConfigNode>> map;
+
+    for (const QString &name : names)
+    {
+        object.setMember(name, std::make_unique<ConfigValueNode>(name));
+        map.emplace(name, std::make_unique<ConfigValueNode>(name));
+    }
+
+    runner->run(QStringLiteral("MemberLookup"), parameters, [&]()
+    {
+        for (const QString &name : names)
+        {
+            const auto *node = object.member(name);
+            Q_ASSERT(node != nullptr);
+            Q_UNUSED(node);
+        }
+    });
+
+    runner->run(QStringLiteral("MapMemberLookup"), parameters, [&]()
+    {
+        for (const QString &name : names)
+        {
+            const auto it = map.find(name);
+            Q_ASSERT(it != map.end());
+            Q_UNUSED(it);
+        }
+    });
+
+    runner->run(QStringLiteral("SetMember"), parameters, [&]()
+    {
+        ConfigObjectNode newObject;
+
+        for (const QString &name : names)
+        {
+            newObject.setMember(name, std::make_unique<ConfigValueNode>(name));
+        }
+    });
+
+    runner->run(QStringLiteral("MapSetMember"), parameters, [&]()
+    {
+        std::map<QString, std::unique_ptr<ConfigNode>> newMap;
+
+        for (const QString &name : names)
+        {
+            newMap[name] = std::make_unique<ConfigValueNode>(name);
+        }
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    BenchmarkRunner runner(QStringLiteral("ConfigNode"), app.arguments());
+
+    if (!runner.isValid())
+    {
+        return runner.finish();
+    }
+
+    for (const int width : { 4, 8, 16 })
+    {
+        ConfigGeneratorParameters parameters;
+        parameters.members = width;
+        parameters.depth = 3;
+
+        benchmarkApply(parameters, &runner);
+        benchmarkClone(parameters, &runner);
+        benchmarkNodeAtPath(parameters, &runner);
+    }
+
+    for (const int memberCount : { 4, 8, 64, 1024 })
+    {
+        benchmarkMembers(memberCount, &runner);
+    }
+
+    return runner.finish();
+}
@@ -0,0 +1,153 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains benchmarks for ConfigNodePath class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodePath.hpp>
+#include "BenchmarkRunner.hpp"
+
+// Qt includes
+#include <QtCore/QCoreApplication>
+#include <QtCore/QRegularExpression>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFrameworkBenchmark;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks validation of node names and compares it to the validation with a regular expression
+ * (the previous implementation)
+ *
+ * \param   nameCount   Number of node names to validate
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkValidateNodeName(const int nameCount, BenchmarkRunner *runner)
+{
+    QJsonObject parameters;
+    parameters[QStringLiteral("names")] = nameCount;
+
+    QStringList names;
+    names.reserve(nameCount);
+
+    for (int i = 0; i < nameCount; i++)
+    {
+        names.append(QStringLiteral("member_name_%1").arg(i));
+    }
+
+    runner->run(QStringLiteral("ValidateNodeName"), parameters, [&]()
+    {
+        for (const QString &name : names)
+        {
+            const bool valid = ConfigNodePath::validateNodeName(name);
+            Q_ASSERT(valid);
+            Q_UNUSED(valid);
+        }
+    });
+
+    runner->run(QStringLiteral("ValidateNodeNames"), parameters, [&]()
+    {
+        const bool valid = ConfigNodePath::validateNodeNames(names);
+        Q_ASSERT(valid);
+        Q_UNUSED(valid);
+    });
+
+    runner->run(QStringLiteral("RegexValidateNodeName"), parameters, [&]()
+    {
+        static const QRegularExpression s_regex(QStringLiteral("^[a-zA-Z][a-zA-Z0-9_]*$"));
+
+        for (const QString &name : names)
+        {
+            const bool valid = s_regex.match(name).hasMatch();
+            Q_ASSERT(valid);
+            Q_UNUSED(valid);
+        }
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks creation and validation of node paths
+ *
+ * \param   pathCount   Number of node paths to create
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkNodePath(const int pathCount, BenchmarkRunner *runner)
+{
+    QJsonObject parameters;
+    parameters[QStringLiteral("paths")] = pathCount;
+
+    QStringList paths;
+    paths.reserve(pathCount);
+
+    for (int i = 0; i < pathCount; i++)
+    {
+        paths.append(QStringLiteral("/level1/level2_%1/../level2/member_%2").arg(i % 10).arg(i));
+    }
+
+    runner->run(QStringLiteral("CreateNodePath"), parameters, [&]()
+    {
+        for (const QString &path : paths)
+        {
+            const ConfigNodePath nodePath(path);
+            Q_ASSERT(nodePath.isValid());
+            Q_UNUSED(nodePath);
+        }
+    });
+
+    runner->run(QStringLiteral("ResolveNodePathReferences"), parameters, [&]()
+    {
+        for (const QString &path : paths)
+        {
+            ConfigNodePath nodePath(path);
+            const bool resolved = nodePath.resolveReferences();
+            Q_ASSERT(resolved);
+            Q_UNUSED(resolved);
+        }
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    BenchmarkRunner runner(QStringLiteral("ConfigNodePath"), app.arguments());
+
+    if (!runner.isValid())
+    {
+        return runner.finish();
+    }
+
+    benchmarkValidateNodeName(100000, &runner);
+    benchmarkNodePath(100000, &runner);
+
+    return runner.finish();
+}
@@ -0,0 +1,378 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains benchmarks for ConfigReader class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include "BenchmarkRunner.hpp"
+#include "GeneratedConfig.hpp"
+
+// Qt includes
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDebug>
+#include <QtCore/QTemporaryDir>
+
+// System includes
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFrameworkBenchmark;
+using namespace CppConfigFrameworkTools;
+
+//! Gives the benchmark access to the reference resolution procedure
+class BenchmarkConfigReader : public ConfigReader
+{
+public:
+    using ConfigReaderBase::resolveReferences;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks reading of a configuration file with includes and references (with and without the
+ * streaming parser, memory-mapping of the files, the include cache and parallel loading of the
+ * includes)
+ *
+ * \note    The include cache is shared by all iterations so only the first iteration reads the
+ *          included files
+ *
+ * \param   parameters  Parameters of the generated configuration
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkReadFile(const ConfigGeneratorParameters &parameters, BenchmarkRunner *runner)
+{
+    QTemporaryDir directory;
+
+    if (!directory.isValid())
+    {
+        qWarning() << "Failed to create a temporary directory";
+        return;
+    }
+
+    ConfigGenerator generator(parameters);
+
+    if (!generator.writeFiles(QDir(directory.path())))
+    {
+        qWarning() << "Failed to write the generated configuration files";
+        return;
+    }
+
+    const QString filePath =
+            QDir(directory.path()).absoluteFilePath(ConfigGenerator::mainFileName());
+
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+
+    struct Variant
+    {
+        QString name;
+        bool streamingParserEnabled;
+        bool memoryMappingEnabled;
+        bool includeCacheEnabled;
+        bool parallelIncludesEnabled;
+        bool arenaAllocationEnabled;
+    };
+
+    const std::vector<Variant> variants {
+        { QStringLiteral("ReadFile"), false, false, false, false, false },
+        { QStringLiteral("ReadFileMapped"), false, true, false, false, false },
+        { QStringLiteral("ReadFileStreaming"), true, false, false, false, false },
+        { QStringLiteral("ReadFileStreamingMapped"), true, true, false, false, false },
+        { QStringLiteral("ReadFileIncludeCache"), false, false, true, false, false },
+        { QStringLiteral("ReadFileParallelIncludes"), false, false, false, true, false },
+        { QStringLiteral("ReadFileStreamingParallelIncludes"), true, false, false, true, false },
+        { QStringLiteral("ReadFileArena"), false, false, false, false, true }
+    };
+
+    for (const auto &variant : variants)
+    {
+        ConfigReader configReader;
+        configReader.setStreamingParserEnabled(variant.streamingParserEnabled);
+        configReader.setMemoryMappingEnabled(variant.memoryMappingEnabled);
+        configReader.setParallelIncludesEnabled(variant.parallelIncludesEnabled);
+        configReader.setArenaAllocationEnabled(variant.arenaAllocationEnabled);
+
+        if (variant.includeCacheEnabled)
+        {
+            configReader.setIncludeCache(std::make_shared<ConfigIncludeCache>());
+        }
+
+        runner->run(variant.name, parameters.toJson(), [&]()
+        {
+            auto environmentVariables = processEnvironmentVariables;
+            auto config = configReader.read(filePath,
+                                            QDir(directory.path()),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &environmentVariables);
+            Q_ASSERT(config);
+        });
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks reading of a configuration from JSON (without file access and includes)
+ *
+ * \param   parameters  Parameters of the generated configuration
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkReadJson(const ConfigGeneratorParameters &parameters, BenchmarkRunner *runner)
+{
+    auto jsonParameters = parameters;
+    jsonParameters.includeChains = 0;
+
+    const QJsonObject configObject =
+            ConfigGenerator(jsonParameters).generate().at(ConfigGenerator::mainFileName());
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    const ConfigReader configReader;
+
+    runner->run(QStringLiteral("ReadJson"), jsonParameters.toJson(), [&]()
+    {
+        auto environmentVariables = processEnvironmentVariables;
+        auto config = configReader.read(configObject,
+                                        QDir::current(),
+                                        ConfigNodePath::ROOT_PATH,
+                                        ConfigNodePath::ROOT_PATH,
+                                        {},
+                                        &environmentVariables);
+        Q_ASSERT(config);
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks the memory used by the configurations read with and without interning of the member
+ * names
+ *
+ * \param   parameters  Parameters of the generated configuration
+ *
+ * \param[in,out]   runner  Benchmark runner
+ *
+ * \note    The configurations read in all iterations are kept until the end of the benchmark so
+ *          that the increase of the peak resident set size reflects the size of the configurations
+ */
+static void benchmarkNameInterning(const ConfigGeneratorParameters &parameters,
+                                   BenchmarkRunner *runner)
+{
+    auto jsonParameters = parameters;
+    jsonParameters.includeChains = 0;
+
+    const QJsonObject configObject =
+            ConfigGenerator(jsonParameters).generate().at(ConfigGenerator::mainFileName());
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+
+    for (const bool nameInterningEnabled : { false, true })
+    {
+        ConfigReader configReader;
+
+        if (nameInterningEnabled)
+        {
+            configReader.setNameTable(std::make_shared<ConfigNameTable>());
+        }
+
+        const QString benchmarkName = nameInterningEnabled
+                                      ? QStringLiteral("RetainJsonInternedNames")
+                                      : QStringLiteral("RetainJson");
+        std::vector<std::unique_ptr<ConfigObjectNode>> configs;
+
+        runner->run(benchmarkName, jsonParameters.toJson(), [&]()
+        {
+            auto environmentVariables = processEnvironmentVariables;
+            auto config = configReader.read(configObject,
+                                            QDir::current(),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &environmentVariables);
+            Q_ASSERT(config);
+            configs.push_back(std::move(config));
+        });
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks the reference resolution procedure
+ *
+ * \param   parameters  Parameters of the generated configuration
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkResolveReferences(const ConfigGeneratorParameters &parameters,
+                                       BenchmarkRunner *runner)
+{
+    ConfigGenerator generator(parameters);
+    const QJsonObject tree = generator.generateTree();
+    const QStringList paths = generator.valuePaths();
+    const BenchmarkConfigReader configReader;
+    std::unique_ptr<ConfigObjectNode> config;
+
+    auto setup = [&]()
+    {
+        config = createConfigNode(tree);
+        auto references = std::make_unique<ConfigObjectNode>();
+
+        for (int i = 0; i < parameters.references; i++)
+        {
+            references->setMember(
+                        QString("ref_%1").arg(i),
+                        std::make_unique<ConfigNodeReference>(
+                            ConfigNodePath(paths.at(i % paths.size()))));
+        }
+
+        config->setMember(QStringLiteral("references"), std::move(references));
+    };
+
+    runner->run(QStringLiteral("ResolveReferences"), parameters.toJson(), setup, [&]()
+    {
+        const bool result = configReader.resolveReferences({}, config.get());
+        Q_ASSERT(result);
+        Q_UNUSED(result);
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Benchmarks reading of a generated configuration corpus (with derived objects, environment
+ * variables and include chains) with and without the streaming parser
+ *
+ * \param   parameters  Parameters of the generated configuration
+ *
+ * \param[in,out]   runner  Benchmark runner
+ */
+static void benchmarkReadGeneratedCorpus(
+        const ConfigGeneratorParameters &parameters,
+        BenchmarkRunner *runner)
+{
+    QTemporaryDir directory;
+
+    if (!directory.isValid())
+    {
+        qWarning() << "Failed to create a temporary directory";
+        return;
+    }
+
+    ConfigGenerator generator(parameters);
+
+    if (!generator.writeFiles(QDir(directory.path())))
+    {
+        qWarning() << "Failed to write the generated configuration files";
+        return;
+    }
+
+    const QString filePath =
+            QDir(directory.path()).absoluteFilePath(ConfigGenerator::mainFileName());
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+
+    for (const bool streamingParserEnabled : { false, true })
+    {
+        ConfigReader configReader;
+        configReader.setStreamingParserEnabled(streamingParserEnabled);
+
+        const QString benchmarkName = streamingParserEnabled
+                                      ? QStringLiteral("ReadGeneratedCorpusStreaming")
+                                      : QStringLiteral("ReadGeneratedCorpus");
+
+        runner->run(benchmarkName, parameters.toJson(), [&]()
+        {
+            auto environmentVariables = processEnvironmentVariables;
+            auto config = configReader.read(filePath,
+                                            QDir(directory.path()),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &environmentVariables);
+            Q_ASSERT(config);
+        });
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    BenchmarkRunner runner(QStringLiteral("ConfigReader"), app.arguments());
+
+    if (!runner.isValid())
+    {
+        return runner.finish();
+    }
+
+    for (const int width : { 4, 8, 16 })
+    {
+        ConfigGeneratorParameters parameters;
+        parameters.members = width;
+        parameters.depth = 3;
+        parameters.references = width * 4;
+        parameters.includeChains = 4;
+
+        benchmarkReadFile(parameters, &runner);
+        benchmarkReadJson(parameters, &runner);
+    }
+
+    {
+        ConfigGeneratorParameters parameters;
+        parameters.members = 8;
+        parameters.depth = 4;
+
+        benchmarkNameInterning(parameters, &runner);
+    }
+
+    for (const int references : { 10, 100, 1000 })
+    {
+        ConfigGeneratorParameters parameters;
+        parameters.members = 8;
+        parameters.depth = 3;
+        parameters.references = references;
+
+        benchmarkResolveReferences(parameters, &runner);
+    }
+
+    for (const int derivedObjects : { 10, 100, 300 })
+    {
+        ConfigGeneratorParameters parameters;
+        parameters.members = 8;
+        parameters.depth = 3;
+        parameters.references = derivedObjects * 2;
+        parameters.derivedObjects = derivedObjects;
+        parameters.basesPerDerivedObject = 3;
+        parameters.environmentValues = 20;
+        parameters.includeChains = 2;
+        parameters.includeChainLength = 3;
+
+        benchmarkReadGeneratedCorpus(parameters, &runner);
+    }
+
+    return runner.finish();
+}
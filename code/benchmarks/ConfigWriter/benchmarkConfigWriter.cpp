@@ -0,0 +1,77 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains benchmarks for ConfigWriter functions
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigWriter.hpp>
+#include "BenchmarkRunner.hpp"
+#include "GeneratedConfig.hpp"
+
+// Qt includes
+#include <QtCore/QCoreApplication>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFrameworkBenchmark;
+using namespace CppConfigFrameworkTools;
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    BenchmarkRunner runner(QStringLiteral("ConfigWriter"), app.arguments());
+
+    if (!runner.isValid())
+    {
+        return runner.finish();
+    }
+
+    for (const int width : { 4, 8, 16 })
+    {
+        ConfigGeneratorParameters parameters;
+        parameters.members = width;
+        parameters.depth = 3;
+
+        const auto config = createConfigNode(ConfigGenerator(parameters).generateTree());
+
+        runner.run(QStringLiteral("WriteToJsonConfig"), parameters.toJson(), [&]()
+        {
+            const auto document = ConfigWriter::writeToJsonConfig(*config);
+            Q_ASSERT(document.isObject());
+            Q_UNUSED(document);
+        });
+
+        runner.run(QStringLiteral("ConvertToJsonValue"), parameters.toJson(), [&]()
+        {
+            const auto value = ConfigWriter::convertToJsonValue(*config);
+            Q_ASSERT(value.isObject());
+            Q_UNUSED(value);
+        });
+    }
+
+    return runner.finish();
+}
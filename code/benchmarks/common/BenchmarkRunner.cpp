@@ -0,0 +1,287 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for running benchmarks and reporting their results in JSON format
+ */
+
+// Own header
+#include "BenchmarkRunner.hpp"
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QDateTime>
+#include <QtCore/QDebug>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTextStream>
+
+// System includes
+#include <algorithm>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFrameworkBenchmark
+{
+
+/*!
+ * Resets the peak resident set size of the process (supported only on Linux)
+ */
+static void resetPeakMemoryUsage()
+{
+#ifdef Q_OS_LINUX
+    QFile file(QStringLiteral("/proc/self/clear_refs"));
+
+    if (file.open(QIODevice::WriteOnly))
+    {
+        file.write("5");
+    }
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads a memory usage value of the process (supported only on Linux)
+ *
+ * \param   fieldName   Name of the field in "/proc/self/status" (for example "VmHWM")
+ *
+ * \return  Value in KiB or -1 if it is not available
+ */
+static qint64 memoryUsage(const QByteArray &fieldName)
+{
+#ifdef Q_OS_LINUX
+    QFile file(QStringLiteral("/proc/self/status"));
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return -1;
+    }
+
+    const QByteArray prefix = fieldName + ':';
+
+    for (const QByteArray &line : file.readAll().split('\n'))
+    {
+        if (line.startsWith(prefix))
+        {
+            // Format: "<name>:   <value> kB"
+            const QByteArray value = line.mid(prefix.size()).simplified().split(' ').first();
+            bool ok = false;
+            const qint64 valueKiB = value.toLongLong(&ok);
+            return ok ? valueKiB : -1;
+        }
+    }
+#else
+    Q_UNUSED(fieldName)
+#endif
+
+    return -1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+BenchmarkRunner::BenchmarkRunner(const QString &suiteName, const QStringList &arguments)
+    : m_suiteName(suiteName),
+      m_iterations(10),
+      m_valid(true)
+{
+    QCommandLineParser parser;
+
+    const QCommandLineOption outputOption(QStringLiteral("output"),
+                                          QStringLiteral("Output file for the results"),
+                                          QStringLiteral("file"));
+    const QCommandLineOption iterationsOption(QStringLiteral("iterations"),
+                                              QStringLiteral("Number of measured iterations"),
+                                              QStringLiteral("count"));
+    const QCommandLineOption filterOption(QStringLiteral("filter"),
+                                          QStringLiteral("Run only matching benchmarks"),
+                                          QStringLiteral("text"));
+
+    parser.addOption(outputOption);
+    parser.addOption(iterationsOption);
+    parser.addOption(filterOption);
+
+    if (!parser.parse(arguments))
+    {
+        qWarning() << "Invalid command line arguments:" << parser.errorText();
+        m_valid = false;
+        return;
+    }
+
+    m_outputFilePath = parser.value(outputOption);
+    m_filter = parser.value(filterOption);
+
+    if (parser.isSet(iterationsOption))
+    {
+        bool ok = false;
+        m_iterations = parser.value(iterationsOption).toInt(&ok);
+
+        if ((!ok) || (m_iterations < 1))
+        {
+            qWarning() << "Invalid number of iterations:" << parser.value(iterationsOption);
+            m_valid = false;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool BenchmarkRunner::isValid() const
+{
+    return m_valid;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void BenchmarkRunner::run(const QString &benchmarkName,
+                          const QJsonObject &parameters,
+                          const std::function<void()> &setup,
+                          const std::function<void()> &body)
+{
+    if ((!m_filter.isEmpty()) && (!benchmarkName.contains(m_filter)))
+    {
+        return;
+    }
+
+    // Warm-up
+    if (setup)
+    {
+        setup();
+    }
+
+    body();
+
+    // Measure
+    std::vector<qint64> durations;
+    durations.reserve(static_cast<size_t>(m_iterations));
+
+    resetPeakMemoryUsage();
+    const qint64 startMemoryUsage = memoryUsage("VmRSS");
+
+    for (int i = 0; i < m_iterations; i++)
+    {
+        if (setup)
+        {
+            setup();
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        body();
+        durations.push_back(timer.nsecsElapsed());
+    }
+
+    const qint64 peakMemoryUsage = memoryUsage("VmHWM");
+
+    // Calculate statistics
+    std::sort(durations.begin(), durations.end());
+
+    qint64 sum = 0;
+
+    for (const qint64 duration : durations)
+    {
+        sum += duration;
+    }
+
+    const size_t count = durations.size();
+    const qint64 median = ((count % 2U) == 1U)
+                          ? durations.at(count / 2U)
+                          : ((durations.at((count / 2U) - 1U) + durations.at(count / 2U)) / 2);
+
+    QJsonObject result {
+        { QStringLiteral("name"), benchmarkName },
+        { QStringLiteral("parameters"), parameters },
+        { QStringLiteral("iterations"), m_iterations },
+        { QStringLiteral("min_ns"), static_cast<double>(durations.front()) },
+        { QStringLiteral("median_ns"), static_cast<double>(median) },
+        { QStringLiteral("mean_ns"), static_cast<double>(sum) / static_cast<double>(count) },
+        { QStringLiteral("max_ns"), static_cast<double>(durations.back()) }
+    };
+
+    if ((startMemoryUsage >= 0) && (peakMemoryUsage >= 0))
+    {
+        result.insert(QStringLiteral("peak_memory_increase_kib"),
+                      static_cast<double>(std::max<qint64>(0, peakMemoryUsage - startMemoryUsage)));
+    }
+
+    qInfo().noquote() << QString("%1: %2 (median: %3 us)")
+                         .arg(benchmarkName,
+                              QString::fromUtf8(QJsonDocument(parameters)
+                                                .toJson(QJsonDocument::Compact)))
+                         .arg(static_cast<double>(median) / 1000.0, 0, 'f', 1);
+
+    m_results.append(result);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void BenchmarkRunner::run(const QString &benchmarkName,
+                          const QJsonObject &parameters,
+                          const std::function<void()> &body)
+{
+    run(benchmarkName, parameters, {}, body);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int BenchmarkRunner::finish() const
+{
+    if (!m_valid)
+    {
+        return 1;
+    }
+
+    const QJsonObject report {
+        { QStringLiteral("suite"), m_suiteName },
+        { QStringLiteral("qt_version"), QString::fromLatin1(qVersion()) },
+        { QStringLiteral("timestamp"), QDateTime::currentDateTimeUtc().toString(Qt::ISODate) },
+        { QStringLiteral("results"), m_results }
+    };
+
+    const QByteArray reportData = QJsonDocument(report).toJson(QJsonDocument::Indented);
+
+    if (m_outputFilePath.isEmpty())
+    {
+        QTextStream(stdout) << QString::fromUtf8(reportData);
+        return 0;
+    }
+
+    QFile file(m_outputFilePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qWarning() << "Failed to open the output file:" << m_outputFilePath;
+        return 1;
+    }
+
+    if (file.write(reportData) != static_cast<qint64>(reportData.size()))
+    {
+        qWarning() << "Failed to write the results to the output file:" << m_outputFilePath;
+        return 1;
+    }
+
+    return 0;
+}
+
+} // namespace CppConfigFrameworkBenchmark
@@ -0,0 +1,119 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for running benchmarks and reporting their results in JSON format
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+
+// System includes
+#include <functional>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFrameworkBenchmark
+{
+
+/*!
+ * This class runs benchmarks and collects their results
+ *
+ * Supported command line arguments:
+ * - "--output <file>": path to the output file for the results (default: standard output)
+ * - "--iterations <count>": number of measured iterations for each benchmark (default: 10)
+ * - "--filter <text>": runs only the benchmarks whose name contains the specified text
+ *
+ * The results are written in JSON format when finish() is called. On Linux the results also
+ * contain the increase of the peak resident set size of the process during the measured iterations.
+ */
+class BenchmarkRunner
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   suiteName   Name of the benchmark suite
+     * \param   arguments   Command line arguments
+     */
+    BenchmarkRunner(const QString &suiteName, const QStringList &arguments);
+
+    /*!
+     * Checks if the command line arguments were valid
+     *
+     * \retval  true    Valid
+     * \retval  false   Invalid
+     */
+    bool isValid() const;
+
+    /*!
+     * Runs the benchmark
+     *
+     * \param   benchmarkName   Name of the benchmark
+     * \param   parameters      Parameters of the benchmark (written to the results)
+     * \param   setup           Function that prepares each iteration (it is not measured)
+     * \param   body            Function to measure
+     *
+     * One unmeasured warm-up iteration is executed before the measured iterations.
+     */
+    void run(const QString &benchmarkName,
+             const QJsonObject &parameters,
+             const std::function<void()> &setup,
+             const std::function<void()> &body);
+
+    //! \copydoc    BenchmarkRunner::run()
+    void run(const QString &benchmarkName,
+             const QJsonObject &parameters,
+             const std::function<void()> &body);
+
+    /*!
+     * Writes the results
+     *
+     * \return  Exit code for the benchmark application
+     */
+    int finish() const;
+
+private:
+    //! Holds the name of the benchmark suite
+    QString m_suiteName;
+
+    //! Holds the path to the output file (empty string for standard output)
+    QString m_outputFilePath;
+
+    //! Holds the filter for benchmark names
+    QString m_filter;
+
+    //! Holds the number of measured iterations
+    int m_iterations;
+
+    //! Holds the validity of command line arguments
+    bool m_valid;
+
+    //! Holds the results
+    QJsonArray m_results;
+};
+
+} // namespace CppConfigFrameworkBenchmark
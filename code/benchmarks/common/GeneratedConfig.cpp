@@ -0,0 +1,60 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains functions for using the generated configurations in benchmarks
+ */
+
+// Own header
+#include "GeneratedConfig.hpp"
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFrameworkBenchmark
+{
+
+std::unique_ptr<CppConfigFramework::ConfigObjectNode> createConfigNode(const QJsonObject &tree)
+{
+    auto node = std::make_unique<CppConfigFramework::ConfigObjectNode>();
+
+    for (auto it = tree.begin(); it != tree.end(); it++)
+    {
+        if (it.value().isObject())
+        {
+            node->setMember(it.key(), createConfigNode(it.value().toObject()));
+        }
+        else
+        {
+            node->setMember(it.key(),
+                            std::make_unique<CppConfigFramework::ConfigValueNode>(it.value()));
+        }
+    }
+
+    return node;
+}
+
+} // namespace CppConfigFrameworkBenchmark
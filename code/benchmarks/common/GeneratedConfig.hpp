@@ -0,0 +1,50 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains functions for using the generated configurations in benchmarks
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include "ConfigGenerator.hpp"
+
+// Qt includes
+#include <QtCore/QJsonObject>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFrameworkBenchmark
+{
+
+/*!
+ * Creates a configuration node from a tree generated with the config generator
+ *
+ * \param   tree    Tree of Object and Value nodes (see CppConfigFrameworkTools::ConfigGenerator)
+ *
+ * \return  Configuration node instance
+ */
+std::unique_ptr<CppConfigFramework::ConfigObjectNode> createConfigNode(const QJsonObject &tree);
+
+} // namespace CppConfigFrameworkBenchmark
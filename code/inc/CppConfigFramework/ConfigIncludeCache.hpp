@@ -0,0 +1,255 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a cache for the included configuration files
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReaderBase.hpp>
+#include <CppConfigFramework/EnvironmentVariables.hpp>
+
+// Qt includes
+#include <QtCore/QDateTime>
+#include <QtCore/QMutex>
+
+// System includes
+#include <map>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds the parsed and resolved included configurations so that a configuration file
+ * which is included multiple times (in the same or in consecutive read procedures) is read only
+ * once per process
+ *
+ * A cached configuration is identified by the absolute path of the included file and its source
+ * and destination node paths. It is used only if:
+ * - The included file and all of the files that it (indirectly) includes still have the same size
+ *   and modification time
+ * - The environment variables that were used while reading the configuration (before they were set
+ *   by the configuration itself) still have the same values
+ * - The nodes which were looked up in the external configuration nodes are still not found in the
+ *   external configuration nodes of the include
+ *
+ * The changes that reading of the configuration made to the environment variables are applied again
+ * when a cached configuration is used.
+ *
+ * Configurations that use nodes from the external configuration nodes of the include or that
+ * (indirectly) include configurations of other types than "CppConfigFramework" are not cached.
+ *
+ * \note    The cache can be shared between readers and threads
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigIncludeCache
+{
+public:
+    //! Holds the information about a read configuration file
+    struct FileInfo
+    {
+        //! Absolute path to the file
+        QString filePath;
+
+        //! Size of the file
+        qint64 size = 0;
+
+        //! Modification time of the file
+        QDateTime lastModified;
+    };
+
+    //! Holds the dependencies of a read configuration
+    struct Dependencies
+    {
+        //! Read configuration files
+        std::vector<FileInfo> files;
+
+        //! Lookups of the referenced nodes in the external configuration nodes
+        std::vector<ConfigReaderBase::ExternalNodeLookup> externalNodeLookups;
+
+        //! Flag which tells if the configuration can be cached
+        bool cacheable = true;
+
+        /*!
+         * Adds the other dependencies to these dependencies
+         *
+         * \param   other   Other dependencies
+         */
+        void merge(const Dependencies &other);
+    };
+
+    //! Constructor
+    ConfigIncludeCache() = default;
+
+    //! Copy constructor is disabled
+    ConfigIncludeCache(const ConfigIncludeCache &) = delete;
+
+    //! Move constructor is disabled
+    ConfigIncludeCache(ConfigIncludeCache &&) = delete;
+
+    //! Destructor
+    ~ConfigIncludeCache() = default;
+
+    //! Copy assignment operator is disabled
+    ConfigIncludeCache &operator=(const ConfigIncludeCache &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigIncludeCache &operator=(ConfigIncludeCache &&) = delete;
+
+    /*!
+     * Gets the number of cached configurations
+     *
+     * \return  Number of cached configurations
+     */
+    int count() const;
+
+    //! Removes all cached configurations
+    void clear();
+
+    /*!
+     * Finds a cached configuration
+     *
+     * \param   filePath            Absolute path to the included configuration file
+     * \param   sourceNodePath      Source node path of the include
+     * \param   destinationNodePath Destination node path of the include
+     * \param   externalConfigs     External configuration nodes of the include
+     *
+     * \param[in,out]   environmentVariables    Environment variables (on success the changes made
+     *                                          by the cached configuration are applied)
+     *
+     * \param[out]  dependencies    Output for the dependencies of the cached configuration
+     *
+     * \return  Copy of the cached configuration or null if it was not found
+     */
+    std::unique_ptr<ConfigObjectNode> find(
+            const QString &filePath,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables,
+            Dependencies *dependencies);
+
+    /*!
+     * Stores the configuration in the cache
+     *
+     * \param   filePath                    Absolute path to the included configuration file
+     * \param   sourceNodePath              Source node path of the include
+     * \param   destinationNodePath         Destination node path of the include
+     * \param   externalConfigs             External configuration nodes of the include
+     * \param   initialEnvironmentVariables Environment variables before the configuration was read
+     * \param   finalEnvironmentVariables   Environment variables after the configuration was read
+     * \param   accessRecord                Environment variables accessed while reading
+     * \param   dependencies                Dependencies of the configuration
+     * \param   config                      Read configuration
+     *
+     * \retval  true    Configuration was stored
+     * \retval  false   Configuration cannot be cached
+     */
+    bool insert(const QString &filePath,
+                const ConfigNodePath &sourceNodePath,
+                const ConfigNodePath &destinationNodePath,
+                const std::vector<const ConfigObjectNode *> &externalConfigs,
+                const EnvironmentVariables &initialEnvironmentVariables,
+                const EnvironmentVariables &finalEnvironmentVariables,
+                const EnvironmentVariables::AccessRecord &accessRecord,
+                const Dependencies &dependencies,
+                const ConfigObjectNode &config);
+
+private:
+    //! Holds the value of an environment variable required by a cached configuration
+    struct EnvironmentVariableValue
+    {
+        //! Name of the environment variable
+        QString name;
+
+        //! Flag which tells if the environment variable is set
+        bool isSet = false;
+
+        //! Value of the environment variable
+        QString value;
+    };
+
+    //! Holds a cached configuration
+    struct Entry
+    {
+        //! Dependencies of the configuration
+        Dependencies dependencies;
+
+        //! Environment variables required by the configuration
+        std::vector<EnvironmentVariableValue> requiredEnvironmentVariables;
+
+        //! Environment variables set by the configuration
+        std::vector<std::pair<QString, QString>> environmentVariableChanges;
+
+        //! Cached configuration
+        std::unique_ptr<ConfigObjectNode> config;
+    };
+
+    /*!
+     * Creates the key of a cached configuration
+     *
+     * \param   filePath            Absolute path to the included configuration file
+     * \param   sourceNodePath      Source node path of the include
+     * \param   destinationNodePath Destination node path of the include
+     *
+     * \return  Key
+     */
+    static QString createKey(const QString &filePath,
+                             const ConfigNodePath &sourceNodePath,
+                             const ConfigNodePath &destinationNodePath);
+
+    /*!
+     * Checks if all of the read configuration files are unchanged
+     *
+     * \param   files   Read configuration files
+     *
+     * \retval  true    Files are unchanged
+     * \retval  false   At least one of the files was changed
+     */
+    static bool areFilesUnchanged(const std::vector<FileInfo> &files);
+
+    /*!
+     * Checks if none of the looked up nodes can be found in the external configuration nodes
+     *
+     * \param   externalNodeLookups Lookups of the referenced nodes
+     * \param   externalConfigs     External configuration nodes
+     *
+     * \retval  true    None of the nodes were found
+     * \retval  false   At least one node was found
+     */
+    static bool areExternalNodesMissing(
+            const std::vector<ConfigReaderBase::ExternalNodeLookup> &externalNodeLookups,
+            const std::vector<const ConfigObjectNode *> &externalConfigs);
+
+private:
+    //! Holds the mutex for the cached configurations
+    mutable QMutex m_mutex;
+
+    //! Holds the cached configurations (there can be multiple variants for different environments)
+    std::map<QString, std::vector<std::shared_ptr<const Entry>>> m_entries;
+};
+
+} // namespace CppConfigFramework
@@ -65,6 +65,75 @@ public:
     template<typename T, std::enable_if_t<std::is_base_of<ConfigItem, T>::value, bool> = true>
     using ContainerItemCreator = std::function<T(const QString &name)>;
 
+    /*!
+     * This class holds a reference to the name of a configuration parameter
+     *
+     * It can be created from a QString, a QLatin1String or a string literal (interpreted as a
+     * Latin-1 string) without copying the name, so the configuration parameters can be looked up
+     * by their names without allocating memory.
+     *
+     * \note    The referenced name must outlive the object, so it is meant to be used only as a
+     *          function parameter
+     */
+    class CPPCONFIGFRAMEWORK_EXPORT ParameterName
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   name    Name of the configuration parameter
+         */
+        ParameterName(const QString &name);
+
+        //! \copydoc    ParameterName::ParameterName(const QString &)
+        ParameterName(QLatin1String name);
+
+        //! \copydoc    ParameterName::ParameterName(const QString &)
+        ParameterName(const char *name);
+
+        /*!
+         * Checks if the name is a valid configuration node name
+         *
+         * \retval  true    Valid
+         * \retval  false   Invalid
+         */
+        bool isValid() const;
+
+        /*!
+         * Gets the member of the configuration node with this name
+         *
+         * \param   config  Configuration node
+         *
+         * \return  Configuration node or nullptr if the member was not found
+         */
+        const ConfigNode *member(const ConfigObjectNode &config) const;
+
+        /*!
+         * Inserts a new member node or replaces an existing member node with this name
+         *
+         * \param   config  Configuration node
+         * \param   node    Member node value
+         *
+         * \retval  true    Success
+         * \retval  false   Failure
+         */
+        bool setMember(ConfigObjectNode *config, std::unique_ptr<ConfigNode> node) const;
+
+        /*!
+         * Converts the name to a string
+         *
+         * \return  Name of the configuration parameter
+         */
+        QString toString() const;
+
+    private:
+        //! Holds the name if it was created from a QString
+        const QString *m_string;
+
+        //! Holds the name if it was created from a Latin-1 string
+        QLatin1String m_latin1String;
+    };
+
 public:
     //! Constructor
     ConfigItem() = default;
@@ -216,7 +285,7 @@ protected:
      */
     template<typename T>
     bool loadRequiredConfigParameter(T *parameterValue,
-                                     const QString &parameterName,
+                                     ParameterName parameterName,
                                      const ConfigObjectNode &config);
 
     /*!
@@ -236,7 +305,7 @@ protected:
      */
     template<typename T>
     bool loadRequiredConfigParameter(T *parameterValue,
-                                     const QString &parameterName,
+                                     ParameterName parameterName,
                                      const ConfigObjectNode &config,
                                      ConfigParameterValidator<T> validator);
 
@@ -258,7 +327,7 @@ protected:
      */
     template<typename T>
     bool loadOptionalConfigParameter(T *parameterValue,
-                                     const QString &parameterName,
+                                     ParameterName parameterName,
                                      const ConfigObjectNode &config,
                                      bool *loaded = nullptr);
 
@@ -281,7 +350,7 @@ protected:
      */
     template<typename T>
     bool loadOptionalConfigParameter(T *parameterValue,
-                                     const QString &parameterName,
+                                     ParameterName parameterName,
                                      const ConfigObjectNode &config,
                                      ConfigParameterValidator<T> validator,
                                      bool *loaded = nullptr);
@@ -303,7 +372,7 @@ protected:
      */
     template<typename T>
     bool loadRequiredConfigContainer(T *container,
-                                     const QString &parameterName,
+                                     ParameterName parameterName,
                                      const ConfigObjectNode &config);
 
     /*!
@@ -325,7 +394,7 @@ protected:
     template<typename T>
     bool loadRequiredConfigContainer(
             T *container,
-            const QString &parameterName,
+            ParameterName parameterName,
             const ConfigObjectNode &config,
             ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator);
 
@@ -348,7 +417,7 @@ protected:
      */
     template<typename T>
     bool loadOptionalConfigContainer(T *container,
-                                     const QString &parameterName,
+                                     ParameterName parameterName,
                                      const ConfigObjectNode &config,
                                      bool *loaded = nullptr);
 
@@ -373,7 +442,7 @@ protected:
     template<typename T>
     bool loadOptionalConfigContainer(
             T *container,
-            const QString &parameterName,
+            ParameterName parameterName,
             const ConfigObjectNode &config,
             ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator,
             bool *loaded = nullptr);
@@ -394,7 +463,7 @@ protected:
      */
     template<typename T>
     bool storeConfigParameter(const T &parameterValue,
-                              const QString &parameterName,
+                              ParameterName parameterName,
                               ConfigObjectNode *config);
 
     /*!
@@ -414,7 +483,7 @@ protected:
      */
     template<typename T>
     bool storeConfigContainer(T &container,
-                              const QString &parameterName,
+                              ParameterName parameterName,
                               ConfigObjectNode *config);
 
     /*!
@@ -548,7 +617,7 @@ private:
 
 template<typename T>
 bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
-                                             const QString &parameterName,
+                                             ParameterName parameterName,
                                              const ConfigObjectNode &config)
 {
     return loadRequiredConfigParameter(parameterValue,
@@ -561,31 +630,31 @@ bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
 
 template<typename T>
 bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
-                                             const QString &parameterName,
+                                             ParameterName parameterName,
                                              const ConfigObjectNode &config,
                                              ConfigParameterValidator<T> validator)
 {
     // Validate parameters
     Q_ASSERT(parameterValue != nullptr);
 
-    if (!ConfigNodePath::validateNodeName(parameterName))
+    if (!parameterName.isValid())
     {
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
-                                    .arg(parameterName, config.nodePath().path());
+                                    .arg(parameterName.toString(), config.nodePath().path());
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
         return false;
     }
 
     // Get parameter's configuration node
-    const auto *node = config.member(parameterName);
+    const auto *node = parameterName.member(config);
 
     if (node == nullptr)
     {
         const QString errorString = QString("Configuration parameter node with name [%1] was not "
                                             "found in configuration node [%2]!")
-                                    .arg(parameterName, config.nodePath().path());
+                                    .arg(parameterName.toString(), config.nodePath().path());
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
         return false;
@@ -599,7 +668,7 @@ bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
 
 template<typename T>
 bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
-                                             const QString &parameterName,
+                                             ParameterName parameterName,
                                              const ConfigObjectNode &config,
                                              bool *loaded)
 {
@@ -614,7 +683,7 @@ bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
 
 template<typename T>
 bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
-                                             const QString &parameterName,
+                                             ParameterName parameterName,
                                              const ConfigObjectNode &config,
                                              ConfigParameterValidator<T> validator,
                                              bool *loaded)
@@ -622,11 +691,11 @@ bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
     // Validate parameters
     Q_ASSERT(parameterValue != nullptr);
 
-    if (!ConfigNodePath::validateNodeName(parameterName))
+    if (!parameterName.isValid())
     {
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
-                                    .arg(parameterName, config.nodePath().path());
+                                    .arg(parameterName.toString(), config.nodePath().path());
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
 
@@ -638,7 +707,7 @@ bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
     }
 
     // Get parameter's configuration node
-    const auto *node = config.member(parameterName);
+    const auto *node = parameterName.member(config);
 
     if (node == nullptr)
     {
@@ -664,7 +733,7 @@ bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
 
 template<typename T>
 bool ConfigItem::loadRequiredConfigContainer(T *container,
-                                             const QString &parameterName,
+                                             ParameterName parameterName,
                                              const ConfigObjectNode &config)
 {
     using ItemType = typename ConfigContainerHelper<T>::ItemType;
@@ -680,7 +749,7 @@ bool ConfigItem::loadRequiredConfigContainer(T *container,
 template<typename T>
 bool ConfigItem::loadRequiredConfigContainer(
         T *container,
-        const QString &parameterName,
+        ParameterName parameterName,
         const ConfigObjectNode &config,
         ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator)
 {
@@ -689,24 +758,24 @@ bool ConfigItem::loadRequiredConfigContainer(
     // Validate parameters
     Q_ASSERT(container != nullptr);
 
-    if (!ConfigNodePath::validateNodeName(parameterName))
+    if (!parameterName.isValid())
     {
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
-                                    .arg(parameterName, config.nodePath().path());
+                                    .arg(parameterName.toString(), config.nodePath().path());
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
         return false;
     }
 
     // Get container's configuration node
-    const auto *node = config.member(parameterName);
+    const auto *node = parameterName.member(config);
 
     if (node == nullptr)
     {
         const QString errorString = QString("Configuration parameter node with name [%1] was not "
                                             "found in configuration node [%2]!")
-                                    .arg(parameterName, config.nodePath().path());
+                                    .arg(parameterName.toString(), config.nodePath().path());
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
         return false;
@@ -720,7 +789,7 @@ bool ConfigItem::loadRequiredConfigContainer(
 
 template<typename T>
 bool ConfigItem::loadOptionalConfigContainer(T *container,
-                                             const QString &parameterName,
+                                             ParameterName parameterName,
                                              const ConfigObjectNode &config,
                                              bool *loaded)
 {
@@ -738,7 +807,7 @@ bool ConfigItem::loadOptionalConfigContainer(T *container,
 template<typename T>
 bool ConfigItem::loadOptionalConfigContainer(
         T *container,
-        const QString &parameterName,
+        ParameterName parameterName,
         const ConfigObjectNode &config,
         ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator,
         bool *loaded)
@@ -748,18 +817,18 @@ bool ConfigItem::loadOptionalConfigContainer(
     // Validate parameters
     Q_ASSERT(container != nullptr);
 
-    if (!ConfigNodePath::validateNodeName(parameterName))
+    if (!parameterName.isValid())
     {
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
-                                    .arg(parameterName, config.nodePath().path());
+                                    .arg(parameterName.toString(), config.nodePath().path());
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
         return false;
     }
 
     // Get container's configuration node
-    const auto *node = config.member(parameterName);
+    const auto *node = parameterName.member(config);
 
     if (node == nullptr)
     {
@@ -785,17 +854,17 @@ bool ConfigItem::loadOptionalConfigContainer(
 
 template<typename T>
 bool ConfigItem::storeConfigParameter(const T &parameterValue,
-                                      const QString &parameterName,
+                                      ParameterName parameterName,
                                       ConfigObjectNode *config)
 {
     // Validate parameters
     Q_ASSERT(config != nullptr);
 
-    if (!ConfigNodePath::validateNodeName(parameterName))
+    if (!parameterName.isValid())
     {
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
-                                    .arg(parameterName, config->nodePath().path());
+                                    .arg(parameterName.toString(), config->nodePath().path());
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
         return false;
@@ -805,11 +874,11 @@ bool ConfigItem::storeConfigParameter(const T &parameterValue,
     const auto jsonValue = CedarFramework::serialize(parameterValue);
 
     // Store configuration parameter to the configuration node
-    if (!config->setMember(parameterName, std::make_unique<ConfigValueNode>(jsonValue)))
+    if (!parameterName.setMember(config, std::make_unique<ConfigValueNode>(jsonValue)))
     {
         const QString errorString = QString("Failed to store configuration parameter with name "
                                             "[%1] and value: [%2]")
-                                    .arg(parameterName, jsonToString(jsonValue));
+                                    .arg(parameterName.toString(), jsonToString(jsonValue));
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
         return false;
@@ -822,25 +891,26 @@ bool ConfigItem::storeConfigParameter(const T &parameterValue,
 
 template<typename T>
 bool ConfigItem::storeConfigContainer(T &container,
-                                      const QString &parameterName,
+                                      ParameterName parameterName,
                                       ConfigObjectNode *config)
 {
     // Validate parameters
     Q_ASSERT(config != nullptr);
 
-    if (!ConfigNodePath::validateNodeName(parameterName))
+    if (!parameterName.isValid())
     {
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
-                                    .arg(parameterName, config->nodePath().path());
+                                    .arg(parameterName.toString(), config->nodePath().path());
         qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
         handleError(errorString);
         return false;
     }
 
     // Convert container to an Object node
-    config->setMember(parameterName, std::make_unique<ConfigObjectNode>());
-    ConfigObjectNode *parameterNode = &config->member(parameterName)->toObject();
+    auto containerNode = std::make_unique<ConfigObjectNode>();
+    ConfigObjectNode *parameterNode = containerNode.get();
+    parameterName.setMember(config, std::move(containerNode));
 
     for (auto &it : ConfigContainerHelper<T>::toMap(container))
     {
@@ -0,0 +1,108 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a table of interned member names
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds the interned member names of configuration nodes
+ *
+ * Interning a name returns a string which shares its data with all other strings that were
+ * interned with the same value, so the member names that repeat throughout a configuration (and
+ * the clones made for references and derived objects) are stored only once. Comparison of two
+ * interned strings with the same value also does not need to compare their characters since they
+ * point to the same data.
+ *
+ * \note    The table can be shared between readers and threads
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNameTable
+{
+public:
+    //! Constructor
+    ConfigNameTable() = default;
+
+    //! Copy constructor is disabled
+    ConfigNameTable(const ConfigNameTable &) = delete;
+
+    //! Move constructor is disabled
+    ConfigNameTable(ConfigNameTable &&) = delete;
+
+    //! Destructor
+    ~ConfigNameTable() = default;
+
+    //! Copy assignment operator is disabled
+    ConfigNameTable &operator=(const ConfigNameTable &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigNameTable &operator=(ConfigNameTable &&) = delete;
+
+    /*!
+     * Gets the number of interned names
+     *
+     * \return  Number of interned names
+     */
+    int count() const;
+
+    /*!
+     * Interns the specified name
+     *
+     * \param   name    Name to intern
+     *
+     * \return  Interned name (it shares its data with the other strings interned with this value)
+     */
+    QString intern(const QString &name);
+
+    /*!
+     * Removes the interned names which are no longer used outside of the table
+     *
+     * \return  Number of removed names
+     */
+    int removeUnused();
+
+    //! Removes all interned names
+    void clear();
+
+private:
+    //! Holds the mutex for the interned names
+    mutable QMutex m_mutex;
+
+    //! Holds the interned names
+    QSet<QString> m_names;
+};
+
+} // namespace CppConfigFramework
@@ -27,6 +27,7 @@
 #include <QtCore/QJsonValue>
 
 // System includes
+#include <cstddef>
 
 // Forward declarations
 namespace CppConfigFramework
@@ -89,6 +90,25 @@ public:
     //! Move assignment operator
     ConfigNode &operator=(ConfigNode &&) noexcept = default;
 
+    /*!
+     * Allocates memory for a configuration node
+     *
+     * \param   size    Size of the configuration node
+     *
+     * \return  Allocated memory
+     *
+     * \note    The memory is allocated from the arena which is active on the current thread (see
+     *          ConfigNodeArena) or from the heap if no arena is active
+     */
+    static void *operator new(std::size_t size);
+
+    /*!
+     * Frees memory of a configuration node
+     *
+     * \param   memory  Memory allocated for the configuration node
+     */
+    static void operator delete(void *memory);
+
     /*!
      * Clones just the configuration node contents and not the parent
      *
@@ -160,6 +180,14 @@ public:
      */
     void setParent(ConfigObjectNode *parent);
 
+    /*!
+     * Gets the name of this configuration node in its parent
+     *
+     * \return  Name of this configuration node or an empty string if the node was not stored to
+     *          its parent with ConfigObjectNode::setMember() (for example a root node)
+     */
+    QString nodeName() const;
+
     /*!
      * Gets the root node
      *
@@ -231,6 +259,9 @@ public:
      * \param   nodePath    Node Path
      *
      * \return  Node at specified node path or null if node was not found
+     *
+     * \note    This can create the members of clones and layered Object nodes on the node path (see
+     *          the thread safety note in the ConfigObjectNode class description)
      */
     const ConfigNode *nodeAtPath(const ConfigNodePath &nodePath) const;
 
@@ -252,9 +283,20 @@ public:
      */
     static QString typeToString(const Type type);
 
+protected:
+    //! Discards the members that the parent nodes share with their clones (needed after this node
+    //! was modified)
+    void invalidateParentSharedMembers();
+
 private:
+    //! Object node sets the name of its member nodes
+    friend class ConfigObjectNode;
+
     //! Holds a reference to the parent of this node or null if this is a root node
     ConfigObjectNode *m_parent;
+
+    //! Holds the name of this node in its parent
+    QString m_name;
 };
 
 } // namespace CppConfigFramework
@@ -0,0 +1,184 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains an arena for the memory of configuration nodes
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QtGlobal>
+
+// System includes
+#include <cstddef>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds an arena (monotonic allocator) for the memory of configuration nodes
+ *
+ * While an arena is active on a thread all configuration nodes that are created on that thread are
+ * allocated from it by bumping a pointer in a large memory block, so building of a big node tree
+ * needs only a handful of memory allocations. The memory of the destroyed nodes is not reused, it
+ * is freed all at once when the last node which was allocated from the arena is destroyed (the
+ * node destructors are still executed one by one).
+ *
+ * An arena becomes active on the current thread when it is constructed and it stops being active
+ * when it is destroyed (the previously active arena becomes active again), so the arenas need to
+ * be destroyed in the reverse order of their construction. The nodes can outlive the arena object
+ * and they can be destroyed on any thread.
+ *
+ * \note    The nodes created on other threads (for example by the parallel loading of includes)
+ *          are allocated on the heap
+ *
+ * \note    The memory is freed only when all of the nodes allocated from the arena are destroyed,
+ *          so a single long lived node (or a node that was discarded while building the tree)
+ *          keeps all of the arena's memory blocks alive
+
+ *
+ * \note    The nodes do not store where they were allocated from. While the memory of any arena
+ *          is alive, destroying a node looks up its address in the memory blocks of the arenas.
+ *          Without arenas the nodes are allocated and freed directly on the heap.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeArena
+{
+public:
+    //! This class allocates the nodes on the heap while it exists even if an arena is active
+    class CPPCONFIGFRAMEWORK_EXPORT HeapScope
+    {
+    public:
+        //! Constructor
+        HeapScope();
+
+        //! Copy constructor is disabled
+        HeapScope(const HeapScope &) = delete;
+
+        //! Move constructor is disabled
+        HeapScope(HeapScope &&) = delete;
+
+        //! Destructor
+        ~HeapScope();
+
+        //! Copy assignment operator is disabled
+        HeapScope &operator=(const HeapScope &) = delete;
+
+        //! Move assignment operator is disabled
+        HeapScope &operator=(HeapScope &&) = delete;
+
+    private:
+        //! Holds the arena that was active before this object was constructed
+        ConfigNodeArena *m_previousArena;
+    };
+
+    //! Default size of the arena's memory blocks (in bytes)
+    static const int DEFAULT_BLOCK_SIZE;
+
+    /*!
+     * Constructor (activates the arena on the current thread)
+     *
+     * \param   blockSize   Size of the arena's memory blocks (in bytes)
+     */
+    explicit ConfigNodeArena(const int blockSize = DEFAULT_BLOCK_SIZE);
+
+    //! Copy constructor is disabled
+    ConfigNodeArena(const ConfigNodeArena &) = delete;
+
+    //! Move constructor is disabled
+    ConfigNodeArena(ConfigNodeArena &&) = delete;
+
+    //! Destructor (deactivates the arena on the current thread)
+    ~ConfigNodeArena();
+
+    //! Copy assignment operator is disabled
+    ConfigNodeArena &operator=(const ConfigNodeArena &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigNodeArena &operator=(ConfigNodeArena &&) = delete;
+
+    /*!
+     * Gets the number of memory blocks allocated by the arena
+     *
+     * \return  Number of memory blocks
+     */
+    int blockCount() const;
+
+    /*!
+     * Gets the number of bytes that were allocated for the nodes from the arena
+     *
+     * \return  Number of bytes
+     */
+    qint64 allocatedSize() const;
+
+    /*!
+     * Gets the arena which is active on the current thread
+     *
+     * \return  Active arena or null if no arena is active
+     */
+    static ConfigNodeArena *active();
+
+    /*!
+     * Gets the number of arenas in the process whose memory was not freed yet
+     *
+     * \return  Number of arenas
+     *
+     * \note    The memory of an arena is freed only when the arena and all of the nodes allocated
+     *          from it are destroyed
+     */
+    static int storageCount();
+
+private:
+    //! Nodes allocate their memory through the arena
+    friend class ConfigNode;
+
+    //! Holds the memory blocks of an arena (they are shared between the arena and its nodes)
+    struct Storage;
+
+    /*!
+     * Allocates memory for a configuration node
+     *
+     * \param   size    Size of the node (in bytes)
+     *
+     * \return  Memory allocated from the active arena or from the heap if no arena is active
+     */
+    static void *allocate(const std::size_t size);
+
+    /*!
+     * Frees memory of a configuration node
+     *
+     * \param   memory  Memory allocated with allocate()
+     */
+    static void deallocate(void *memory);
+
+private:
+    //! Holds the memory blocks of the arena
+    Storage *m_storage;
+
+    //! Holds the arena that was active before this arena was constructed
+    ConfigNodeArena *m_previousArena;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,126 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains an index of configuration nodes by their node paths
+ */
+
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds an index of the configuration nodes in a configuration node tree by their
+ * absolute node paths
+ *
+ * The index is built incrementally: a lookup first searches the index for the whole node path, so
+ * a repeated lookup of a node path is a single hash lookup. Only a node path that was not looked up
+ * yet is walked from the root node in the same way as ConfigNode::nodeAtPath() does (each node on
+ * the node path must exist, also the ones before a parent node reference). The walk adds the
+ * visited nodes to the index under their canonical node paths, so that the walks of other node
+ * paths find the already visited nodes with hash lookups instead of member lookups, and the result
+ * is stored under the whole node path. The nodes that are never looked up are not indexed (which
+ * also keeps the members of cloned Object nodes shared).
+ *
+ * \note    The configuration node tree must not be modified while the index is used
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeIndex
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   config  Root of the indexed configuration node tree
+     */
+    explicit ConfigNodeIndex(const ConfigObjectNode &config);
+
+    //! Copy constructor
+    ConfigNodeIndex(const ConfigNodeIndex &) = default;
+
+    //! Move constructor
+    ConfigNodeIndex(ConfigNodeIndex &&) noexcept = default;
+
+    //! Destructor
+    ~ConfigNodeIndex() = default;
+
+    //! Copy assignment operator
+    ConfigNodeIndex &operator=(const ConfigNodeIndex &) = default;
+
+    //! Move assignment operator
+    ConfigNodeIndex &operator=(ConfigNodeIndex &&) noexcept = default;
+
+    /*!
+     * Gets the root of the indexed configuration node tree
+     *
+     * \return  Configuration node
+     */
+    const ConfigObjectNode &config() const;
+
+    /*!
+     * Gets the number of node paths in the index (including the ones of the missing nodes)
+     *
+     * \return  Number of node paths
+     */
+    int count() const;
+
+    /*!
+     * Finds the configuration node at the specified node path
+     *
+     * \param   nodePath    Absolute node path
+     *
+     * \return  Configuration node or null if it was not found
+     */
+    const ConfigNode *find(const ConfigNodePath &nodePath);
+
+    /*!
+     * Finds the configuration node referenced from a node with the specified parent
+     *
+     * \param   referenceNodePath   Absolute or relative node path of the referenced node
+     * \param   parentNodePath      Absolute node path of the parent of the referencing node
+     *
+     * \return  Configuration node or null if it was not found
+     *
+     * \note    A relative node path is looked up relative to the equivalent of the parent node in
+     *          the indexed configuration node tree
+     */
+    const ConfigNode *find(const ConfigNodePath &referenceNodePath,
+                           const ConfigNodePath &parentNodePath);
+
+private:
+    //! Holds the root of the indexed configuration node tree
+    const ConfigObjectNode *m_config;
+
+    //! Holds the indexed nodes by their absolute node paths (null for the missing nodes)
+    QHash<QString, const ConfigNode *> m_nodes;
+};
+
+} // namespace CppConfigFramework
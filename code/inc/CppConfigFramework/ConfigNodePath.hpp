@@ -55,8 +55,12 @@ public:
      */
     ConfigNodePath(const QString &path);
 
-    //! Copy constructor
-    ConfigNodePath(const ConfigNodePath &) = default;
+    /*!
+     * Copy constructor
+     *
+     * \param   other   Node path to copy
+     */
+    ConfigNodePath(const ConfigNodePath &other);
 
     //! Move constructor
     ConfigNodePath(ConfigNodePath &&) noexcept = default;
@@ -64,8 +68,14 @@ public:
     //! Destructor
     ~ConfigNodePath() = default;
 
-    //! Copy assignment operator
-    ConfigNodePath &operator=(const ConfigNodePath &) = default;
+    /*!
+     * Copy assignment operator
+     *
+     * \param   other   Node path to copy
+     *
+     * \return  Reference to this node path instance
+     */
+    ConfigNodePath &operator=(const ConfigNodePath &other);
 
     //! Move assignment operator
     ConfigNodePath &operator=(ConfigNodePath &&) noexcept = default;
@@ -140,11 +150,17 @@ public:
     void setPath(const QString &path);
 
     /*!
-     * Splits the node path to individual node names
+     * Gets the individual node names of the node path
      *
      * \return  Node names
+     *
+     * \note    The root node path and an empty node path do not have any node names (the root node
+     *          path used to return a single empty node name)
+     * \note    The node path is split to node names on the first call and the node names are then
+     *          cached until the node path is modified. The returned reference is valid until then.
+     *          Concurrent calls on the same instance are safe.
      */
-    QStringList nodeNames() const;
+    const QStringList &nodeNames() const;
 
     /*!
      * Creates a new path from this path and (if needed) the working path
@@ -203,6 +219,32 @@ public:
      */
     static bool validateNodeName(const QString &name);
 
+    /*!
+     * Validates the configuration node name
+     *
+     * \param   name    Pointer to the first character of the node name to validate
+     * \param   size    Number of characters in the node name
+     *
+     * \return  true    Valid node name
+     * \return  false   Invalid node name
+     *
+     * \note    This overload can be used to validate a part of a string without copying it
+     */
+    static bool validateNodeName(const QChar *name, const int size);
+
+    //! \copydoc    ConfigNodePath::validateNodeName(const QString &)
+    static bool validateNodeName(QLatin1String name);
+
+    /*!
+     * Validates multiple configuration node names
+     *
+     * \param   names   Node names to validate
+     *
+     * \return  true    All node names are valid
+     * \return  false   At least one of the node names is invalid
+     */
+    static bool validateNodeNames(const QStringList &names);
+
 public:
     //! Root node path value
     static const QString ROOT_PATH_VALUE;
@@ -216,9 +258,26 @@ public:
     //! Parent node path
     static const ConfigNodePath PARENT_PATH;
 
+private:
+    /*!
+     * Updates the node path's properties (validity and unresolved references) from its value
+     *
+     * \note    The node names are checked in place in the node path's value without splitting it
+     */
+    void updateProperties();
+
 private:
     //! Node path's value
     QString m_path;
+
+    //! Node names of the node path (split from the node path's value on first use)
+    mutable std::shared_ptr<const QStringList> m_nodeNames;
+
+    //! Holds the result of node path validation
+    bool m_valid = false;
+
+    //! Holds the flag that indicates that the node path has references to parent nodes ("..")
+    bool m_hasUnresolvedReferences = false;
 };
 
 } // namespace CppConfigFramework
@@ -24,9 +24,11 @@
 #include <CppConfigFramework/ConfigNode.hpp>
 
 // Qt includes
+#include <QtCore/QString>
 
 // System includes
-#include <map>
+#include <memory>
+#include <vector>
 
 // Forward declarations
 
@@ -37,7 +39,16 @@
 namespace CppConfigFramework
 {
 
-//! This class holds the Object configuration node
+/*!
+ * This class holds the Object configuration node
+ *
+ * \warning The members of a clone (see clone()) and of a layered node (see createLayered()) are
+ *          created lazily, when they are first accessed. The const methods (for example member(),
+ *          names(), count() and nodeAtPath()) also do this, and so does the first clone() of a
+ *          node. So a node tree must not be accessed from multiple threads at the same time, even
+ *          if all of them only read it. To share a node tree between threads for reading, call
+ *          flatten() first. If the threads also clone the tree, clone it once before sharing it.
+ */
 class CPPCONFIGFRAMEWORK_EXPORT ConfigObjectNode : public ConfigNode
 {
 public:
@@ -71,7 +82,20 @@ public:
     //! Move assignment operator
     ConfigObjectNode &operator=(ConfigObjectNode &&) noexcept;
 
-    //! \copydoc    ConfigNode::clone()
+    /*!
+     * \copydoc ConfigNode::clone()
+     *
+     * The clone shares an immutable copy of the members with this node (the copy is created on the
+     * first clone and it is reused until this node or one of its members is modified). The clone
+     * creates its own members from the shared ones only when they are accessed, so cloning the
+     * same node many times stores its subtree only once until the clones are accessed.
+     *
+     * The clone of a layered node (see createLayered()) shares the merged members instead of the
+     * layers, so its members are merged before it is cloned.
+     *
+     * \note    Since the members of a clone are created when they are first accessed (also through
+     *          the const methods) a node must not be accessed from multiple threads at once
+     */
     std::unique_ptr<ConfigNode> clone() const override;
 
     //! \copydoc    ConfigNode::type()
@@ -84,6 +108,17 @@ public:
      */
     int count() const;
 
+    /*!
+     * Gets the number of unresolved nodes (NodeReference and DerivedObject nodes) in this node's
+     * subtree
+     *
+     * \return  Number of unresolved nodes
+     *
+     * \note    The number is kept up to date when the members are modified so it can be used to
+     *          check if the subtree is fully resolved without walking it
+     */
+    int unresolvedCount() const;
+
     /*!
      * Checks if the node contains a member with the specified name
      *
@@ -94,6 +129,14 @@ public:
      */
     bool contains(const QString &name) const;
 
+    //! \copydoc    ConfigObjectNode::contains()
+    bool contains(QLatin1String name) const;
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    //! \copydoc    ConfigObjectNode::contains()
+    bool contains(QStringView name) const;
+#endif
+
     /*!
      * Gets the names of all member nodes in this node
      *
@@ -116,12 +159,29 @@ public:
      * \param   name    Name of the member node
      *
      * \return  Configuration node or nullptr if the member was not found
+     *
+     * \note    This can create the members of a clone or a layered node (see the thread safety note
+     *          in the class description)
      */
     const ConfigNode *member(const QString &name) const;
 
     //! \copydoc    ConfigObjectNode::member()
     ConfigNode *member(const QString &name);
 
+    //! \copydoc    ConfigObjectNode::member()
+    const ConfigNode *member(QLatin1String name) const;
+
+    //! \copydoc    ConfigObjectNode::member()
+    ConfigNode *member(QLatin1String name);
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    //! \copydoc    ConfigObjectNode::member()
+    const ConfigNode *member(QStringView name) const;
+
+    //! \copydoc    ConfigObjectNode::member()
+    ConfigNode *member(QStringView name);
+#endif
+
     /*!
      * Inserts a new member node or replaces an existing member node with the same name
      *
@@ -132,12 +192,29 @@ public:
      * \retval  false   Failure
      *
      * \note    When the node is stored its parent is updated to point to this node
+     *
+     * \note    The overloads for QLatin1String and QStringView names create a QString for the name
+     *          only if a new member is inserted
      */
     bool setMember(const QString &name, std::unique_ptr<ConfigNode> node);
 
     //! \copydoc    ConfigObjectNode::setMember()
     bool setMember(const QString &name, const ConfigNode &node);
 
+    //! \copydoc    ConfigObjectNode::setMember()
+    bool setMember(QLatin1String name, std::unique_ptr<ConfigNode> node);
+
+    //! \copydoc    ConfigObjectNode::setMember()
+    bool setMember(QLatin1String name, const ConfigNode &node);
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    //! \copydoc    ConfigObjectNode::setMember()
+    bool setMember(QStringView name, std::unique_ptr<ConfigNode> node);
+
+    //! \copydoc    ConfigObjectNode::setMember()
+    bool setMember(QStringView name, const ConfigNode &node);
+#endif
+
     /*!
      * Removes a member with the specified name
      *
@@ -148,6 +225,17 @@ public:
      */
     bool remove(const QString &name);
 
+    /*!
+     * Removes a member with the specified name and transfers its ownership to the caller
+     *
+     * \param   name    Name of the member node
+     *
+     * \return  Removed member node (without a parent) or null if the member was not found
+     *
+     * \note    The member node is not copied, its subtree stays the same as it was in this node
+     */
+    std::unique_ptr<ConfigNode> take(const QString &name);
+
     //! Removes all members
     void removeAll();
 
@@ -162,9 +250,202 @@ public:
      */
     void apply(const ConfigObjectNode &other);
 
+    /*!
+     * Applies values from the specified node to the matching nodes in this node
+     *
+     * \param   other   Configuration node to apply (it is left empty)
+     *
+     * Same as the copying variant but the members of the other node that are added to this node or
+     * that replace the members of this node are moved instead of cloned.
+     */
+    void apply(ConfigObjectNode &&other);
+
+    /*!
+     * Creates an Object node that is the result of applying the specified nodes (layers) to an
+     * empty Object node in the listed order
+     *
+     * \param   layers  Configuration nodes to apply (the later ones override the earlier ones)
+     *
+     * \return  Layered Object node
+     *
+     * The layered node only shares the members of the layers and it merges them one level at a
+     * time when its members are accessed. Object members which are found in multiple layers become
+     * layered nodes themselves, so only the accessed parts of the subtree are ever merged and the
+     * members that are found in just one layer are shared with that layer until they are accessed.
+     *
+     * \note    If any of the layers except the last one contains unresolved nodes then the layers
+     *          are applied immediately
+     */
+    static std::unique_ptr<ConfigObjectNode> createLayered(
+            const std::vector<const ConfigObjectNode *> &layers);
+
+    /*!
+     * Creates all of the members in this node's subtree that are still shared with other nodes or
+     * that were not merged from the layers yet
+     *
+     * After this the subtree is a standalone tree which no longer shares any nodes with the nodes
+     * it was cloned or layered from, so it can for example be read from multiple threads at the
+     * same time (as long as it is not cloned).
+     */
+    void flatten();
+
+    /*!
+     * Creates a copy of this node's subtree which does not share any nodes with this node or with
+     * the nodes it was cloned or layered from (unlike clone())
+     *
+     * \return  Copy of this node
+     *
+     * \note    All of the nodes of the copy are allocated from the currently active arena (or from
+     *          the heap if no arena is active), so the copy does not keep alive the memory of the
+     *          arenas of this node's subtree
+     */
+    std::unique_ptr<ConfigObjectNode> deepClone() const;
+
+private:
+    //! Nodes invalidate the shared members of their parents when they are modified
+    friend class ConfigNode;
+
+    //! Configuration node member (name and node)
+    using Member = std::pair<QString, std::unique_ptr<ConfigNode>>;
+
+    //! Immutable members shared between an Object node and its clones
+    using SharedMembers = std::vector<Member>;
+
+    /*!
+     * Checks if the member's name is less than the specified name
+     *
+     * \tparam  Name    Type of the name (QString, QLatin1String or QStringView)
+     *
+     * \param   member  Member
+     * \param   name    Name to compare with
+     *
+     * \retval  true    Member's name is less than the specified name
+     * \retval  false   Member's name is not less than the specified name
+     */
+    template<typename Name>
+    static bool isMemberNameLess(const Member &member, const Name &name);
+
+    /*!
+     * Finds the first member with a name that is not less than the specified name
+     *
+     * \tparam  Name    Type of the name (QString, QLatin1String or QStringView)
+     *
+     * \param   name    Name of the member node
+     *
+     * \return  Iterator to the found member or the end iterator
+     */
+    template<typename Name>
+    std::vector<Member>::const_iterator lowerBound(const Name &name) const;
+
+    //! \copydoc    ConfigObjectNode::lowerBound()
+    template<typename Name>
+    std::vector<Member>::iterator lowerBound(const Name &name);
+
+    /*!
+     * Finds the member with the specified name
+     *
+     * \tparam  Name    Type of the name (QString, QLatin1String or QStringView)
+     *
+     * \param   name    Name of the member node
+     *
+     * \return  Iterator to the found member or the end iterator
+     */
+    template<typename Name>
+    std::vector<Member>::const_iterator find(const Name &name) const;
+
+    //! \copydoc    ConfigObjectNode::find()
+    template<typename Name>
+    std::vector<Member>::iterator find(const Name &name);
+
+    /*!
+     * Checks if the node contains a member with the specified name
+     *
+     * \tparam  Name    Type of the name (QString, QLatin1String or QStringView)
+     *
+     * \param   name    Name of the member node
+     *
+     * \retval  true    Member with the specified name was found
+     * \retval  false   Member with the specified name was not found
+     */
+    template<typename Name>
+    bool containsMember(const Name &name) const;
+
+    /*!
+     * Inserts a new member node or replaces an existing member node with the same name
+     *
+     * \tparam  Name    Type of the name (QString, QLatin1String or QStringView)
+     *
+     * \param   name    Name of the member node
+     * \param   node    Member node value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    template<typename Name>
+    bool storeMember(const Name &name, std::unique_ptr<ConfigNode> node);
+
+    /*!
+     * Gets the members of this node without creating them from the shared members
+     *
+     * \return  Members
+     */
+    const std::vector<Member> &members() const;
+
+    //! Creates the members of this node from the shared members if they were not created yet
+    void detach() const;
+
+    //! Creates the members of this node by merging the members of its layers
+    void mergeLayers() const;
+
+    /*!
+     * Gets the immutable copy of the members that is shared with the clones of this node
+     *
+     * \return  Shared members (they are created if needed)
+     */
+    std::shared_ptr<const SharedMembers> sharedMembers() const;
+
+    //! Discards the shared members of this node and its parents (needed when they are modified)
+    void invalidateSharedMembers();
+
+    /*!
+     * Gets the number of unresolved nodes in the specified node's subtree (including the node)
+     *
+     * \param   node    Configuration node
+     *
+     * \return  Number of unresolved nodes
+     */
+    static int unresolvedCount(const ConfigNode &node);
+
+    /*!
+     * Updates the number of unresolved nodes in this node and all of its parents
+     *
+     * \param   delta   Change in the number of unresolved nodes
+     */
+    void updateUnresolvedCount(const int delta);
+
 private:
-    //! Configuration node members
-    std::map<QString, std::unique_ptr<ConfigNode>> m_members;
+    /*!
+     * Configuration node members sorted by their names
+     *
+     * \note    A sorted vector is used instead of a tree based map since most of the Object nodes
+     *          have only a few members, so the contiguous storage and binary search are faster for
+     *          lookups and copies
+     */
+    mutable std::vector<Member> m_members;
+
+    //! Members shared with the clones (if set they match the members of this node)
+    mutable std::shared_ptr<const SharedMembers> m_sharedMembers;
+
+    /*!
+     * Shared members from which the members of this node were not created yet
+     *
+     * \note    A clone has a single layer (its shared members) while a layered node has one layer
+     *          for each of the nodes it was created from
+     */
+    mutable std::vector<std::shared_ptr<const SharedMembers>> m_layers;
+
+    //! Number of unresolved nodes in this node's subtree
+    int m_unresolvedCount = 0;
 };
 
 } // namespace CppConfigFramework
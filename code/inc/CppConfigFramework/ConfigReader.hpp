@@ -21,11 +21,22 @@
 #pragma once
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigIncludeCache.hpp>
+#include <CppConfigFramework/ConfigNameTable.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
 #include <CppConfigFramework/ConfigReaderBase.hpp>
+#include <CppConfigFramework/JsonStreamReader.hpp>
 
 // Qt includes
+#include <QtCore/QFile>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVector>
 
 // System includes
+#include <memory>
+#include <vector>
 
 // Forward declarations
 
@@ -58,6 +69,182 @@ public:
     //! Move assignment operator
     ConfigReader &operator=(ConfigReader &&) noexcept = default;
 
+    /*!
+     * Checks if configuration files are read with the streaming parser
+     *
+     * \retval  true    Streaming parser is used
+     * \retval  false   Configuration files are parsed to a QJsonDocument first
+     */
+    bool isStreamingParserEnabled() const;
+
+    /*!
+     * Enables or disables reading of configuration files with the streaming parser
+     *
+     * \param   enabled New value
+     *
+     * The streaming parser builds the configuration nodes of the 'config' member directly from the
+     * contents of the file instead of creating a QJsonDocument for the whole file first. This
+     * reduces the peak memory usage and the time needed to read big configuration files.
+     *
+     * \note    The 'config' member is read only after the 'environment_variables' and 'includes'
+     *          members regardless of the order of the members in the file.
+     */
+    void setStreamingParserEnabled(const bool enabled);
+
+    /*!
+     * Checks if configuration files are memory-mapped instead of read into memory
+     *
+     * \retval  true    Configuration files are memory-mapped
+     * \retval  false   Configuration files are read into memory
+     */
+    bool isMemoryMappingEnabled() const;
+
+    /*!
+     * Enables or disables memory-mapping of configuration files
+     *
+     * \param   enabled New value
+     *
+     * When enabled the configuration file is parsed directly from the memory-mapped file instead of
+     * from a copy of its contents and the mapping is released once the configuration nodes are
+     * built. This avoids an additional copy of big configuration files (especially in combination
+     * with the streaming parser).
+     *
+     * \note    If the file cannot be memory-mapped then its contents are read into memory
+     */
+    void setMemoryMappingEnabled(const bool enabled);
+
+    /*!
+     * Gets the include cache
+     *
+     * \return  Include cache or null if included configuration files are not cached
+     */
+    std::shared_ptr<ConfigIncludeCache> includeCache() const;
+
+    /*!
+     * Sets the include cache
+     *
+     * \param   includeCache    Include cache (null disables caching of included files)
+     *
+     * When set, the included configuration files of the "CppConfigFramework" type are taken from the
+     * cache if they were already read (in this or in an earlier read procedure) and they or their
+     * environment did not change in the meantime. Otherwise they are read and stored in the cache.
+     *
+     * \note    The same cache can be shared between multiple readers (also in different threads)
+     */
+    void setIncludeCache(const std::shared_ptr<ConfigIncludeCache> &includeCache);
+
+    /*!
+     * Checks if included configuration files are loaded in parallel
+     *
+     * \retval  true    Included configuration files are loaded in parallel
+     * \retval  false   Included configuration files are loaded one after another
+     */
+    bool isParallelIncludesEnabled() const;
+
+    /*!
+     * Enables or disables loading of included configuration files in parallel
+     *
+     * \param   enabled New value
+     *
+     * When enabled, the files of the "CppConfigFramework" includes are read and parsed in advance
+     * in the include thread pool. The environment variables, the 'config' members and the
+     * application of the included configurations are still processed in the declaration order of
+     * the includes so the result is the same as when the includes are loaded one after another.
+     *
+     * \note    The file paths of the includes are expanded before any of the includes is processed.
+     *          If an include changes an environment variable that is used in the file path of a
+     *          later include then that file is loaded again when its include is processed.
+     */
+    void setParallelIncludesEnabled(const bool enabled);
+
+    /*!
+     * Gets the thread pool used for loading of included configuration files in parallel
+     *
+     * \return  Thread pool or null if the global thread pool is used
+     */
+    QThreadPool *includeThreadPool() const;
+
+    /*!
+     * Sets the thread pool used for loading of included configuration files in parallel
+     *
+     * \param   threadPool  Thread pool (null selects the global thread pool)
+     *
+     * \note    The thread pool must outlive the read procedures of this reader
+     */
+    void setIncludeThreadPool(QThreadPool *threadPool);
+
+    /*!
+     * Checks if only the needed parts of the 'config' member are read for a non-root source node
+     *
+     * \retval  true    Only the needed parts of the 'config' member are read
+     * \retval  false   The whole 'config' member is always read
+     */
+    bool isPartialParsingEnabled() const;
+
+    /*!
+     * Enables or disables reading of only the needed parts of the 'config' member
+     *
+     * \param   enabled New value
+     *
+     * When enabled and a configuration is read with a non-root source node path (for example an
+     * include with a 'source_node' parameter), the configuration nodes of the 'config' member are
+     * built only on the source node path, in the source node's subtree and in the subtrees of the
+     * nodes that they (indirectly) reference. All other members are skipped, so reading a small
+     * section of a big configuration file does not build and resolve the whole file.
+     *
+     * \note    The skipped members are not validated, so invalid content in them (for example
+     *          invalid member names, invalid decorated values or references that cannot be
+     *          resolved) is accepted. A configuration that fails to be read with partial parsing
+     *          disabled can therefore be read successfully with it enabled. The JSON syntax of the
+     *          file is still checked completely.
+     */
+    void setPartialParsingEnabled(const bool enabled);
+
+    /*!
+     * Gets the name table
+     *
+     * \return  Name table or null if the member names are not interned
+     */
+    std::shared_ptr<ConfigNameTable> nameTable() const;
+
+    /*!
+     * Sets the name table
+     *
+     * \param   nameTable   Name table (null disables interning of the member names)
+     *
+     * When set, the names of the members read from the configuration files are interned in the
+     * table, so each distinct member name is stored only once in all of the configuration nodes
+     * read with the same table (also in the clones made for references and derived objects).
+     *
+     * \note    The same table can be shared between multiple readers (also in different threads)
+     */
+    void setNameTable(const std::shared_ptr<ConfigNameTable> &nameTable);
+
+    /*!
+     * Checks if the configuration nodes of a read procedure are allocated from an arena
+     *
+     * \retval  true    Configuration nodes are allocated from an arena
+     * \retval  false   Configuration nodes are allocated on the heap
+     */
+    bool isArenaAllocationEnabled() const;
+
+    /*!
+     * Enables or disables allocation of the configuration nodes of a read procedure from an arena
+     *
+     * \param   enabled New value
+     *
+     * When enabled each read procedure allocates the configuration nodes that it creates from its
+     * own ConfigNodeArena (unless an arena is already active on the calling thread), so building of
+     * the configuration node tree needs only a few memory allocations and the memory is freed all
+     * at once when the returned tree is destroyed.
+     *
+     * \note    The arena's memory is freed only after all of the nodes allocated from it are
+     *          destroyed, so nodes that are detached from the returned tree and kept alive after it
+     *          is destroyed keep the whole arena's memory alive (this also applies to the nodes
+     *          that the configurations in the include cache share with the read configurations)
+     */
+    void setArenaAllocationEnabled(const bool enabled);
+
     /*!
      * Read the specified config file
      *
@@ -71,11 +258,15 @@ public:
      *
      * \param[in,out]   environmentVariables    Environment variables
      *
+     * \param[out]  statistics  Optional output for the read statistics
+     *
      * \return  Configuration node instance or in case of failure a null pointer
      *
      * The externalConfigs items are used to provide an additional source for reference resolution.
      * This is mostly useful for includes so that they can declare references to externally defined
      * nodes in its own config file or its includes.
+     *
+     * \note    The statistics are reset at the start of the read procedure
      */
     std::unique_ptr<ConfigObjectNode> read(
             const QString &filePath,
@@ -83,7 +274,8 @@ public:
             const ConfigNodePath &sourceNodePath,
             const ConfigNodePath &destinationNodePath,
             const std::vector<const ConfigObjectNode *> &externalConfigs,
-            EnvironmentVariables *environmentVariables) const;
+            EnvironmentVariables *environmentVariables,
+            ReadStatistics *statistics = nullptr) const;
 
     /*!
      * Read the specified config from JSON
@@ -98,11 +290,15 @@ public:
      *
      * \param[in,out]   environmentVariables    Environment variables
      *
+     * \param[out]  statistics  Optional output for the read statistics
+     *
      * \return  Configuration node instance or in case of failure a null pointer
      *
      * The externalConfigs items are used to provide an additional source for reference resolution.
      * This is mostly useful for includes so that they can declare references to externally defined
      * nodes in its own config file or its includes.
+     *
+     * \note    The statistics are reset at the start of the read procedure
      */
     std::unique_ptr<ConfigObjectNode> read(
             const QJsonObject &configObject,
@@ -110,7 +306,8 @@ public:
             const ConfigNodePath &sourceNodePath,
             const ConfigNodePath &destinationNodePath,
             const std::vector<const ConfigObjectNode *> &externalConfigs,
-            EnvironmentVariables *environmentVariables) const;
+            EnvironmentVariables *environmentVariables,
+            ReadStatistics *statistics = nullptr) const;
 
     //! \copydoc    ConfigReaderBase::read()
     std::unique_ptr<ConfigObjectNode> read(
@@ -121,6 +318,239 @@ public:
             EnvironmentVariables *environmentVariables) const override;
 
 private:
+    //! Tells which part of a member is read when only a part of the 'config' member is needed
+    enum class MemberSelection
+    {
+        //! Member is skipped
+        None,
+
+        //! Only the members of the member that are on one of the selected node paths are read
+        Path,
+
+        //! Member is read with its whole subtree
+        All
+    };
+
+    //! Holds the loaded and parsed contents of a configuration file
+    struct ParsedFile
+    {
+        //! Information about the file
+        ConfigIncludeCache::FileInfo fileInfo;
+
+        //! Holds the file while its contents are memory-mapped
+        std::unique_ptr<QFile> mappedFile;
+
+        //! Contents of the file (JSON format)
+        QByteArray contents;
+
+        //! Flag which tells if the contents are a JSON Object
+        bool isObject = false;
+
+        //! Root JSON Object (only the members needed before the 'config' member with the streaming
+        //! parser)
+        QJsonObject rootObject;
+
+        //! Offset of the value of the 'config' member (streaming parser only)
+        int configMemberOffset = 0;
+
+        //! Offset of the parse error or -1 if there is no error
+        int errorOffset = -1;
+
+        //! Parse error
+        QString errorString;
+    };
+
+    //! Member of the 'config' member that was skipped because it was not selected
+    struct SkippedMember
+    {
+        //! Absolute node path of the parent Object node
+        ConfigNodePath parentNodePath;
+
+        //! Name of the member (without the decorator)
+        QString name;
+
+        //! Decorator of the member name
+        QChar decorator;
+
+        //! Offset of the member value (streaming parser only)
+        int offset = -1;
+
+        //! Member value (only when the member is not read from a JSON stream)
+        QJsonValue value;
+    };
+
+    //! Loads and parses an included configuration file in advance (in the include thread pool)
+    class IncludePrefetch;
+
+    /*!
+     * Read the specified config file
+     *
+     * \param   filePath            Path to the configuration file
+     * \param   workingDir          Path to the working directory
+     * \param   sourceNodePath      Node path to the node that needs to be extracted from this
+     *                              configuration file (must be absolute node path)
+     * \param   destinationNodePath Node path to the destination node where the result needs to be
+     *                              stored (must be absolute node path)
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     * \param[in,out]   statistics              Optional output for the read statistics
+     * \param[in,out]   dependencies            Optional output for the dependencies of the read
+     *                                          configuration (needed for the include cache)
+     * \param[in,out]   prefetch                Optional file loaded in advance (it is used only if
+     *                                          it matches the absolute path of the file)
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> readFile(
+            const QString &filePath,
+            const QDir &workingDir,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables,
+            ReadStatistics *statistics,
+            ConfigIncludeCache::Dependencies *dependencies,
+            IncludePrefetch *prefetch) const;
+
+    /*!
+     * Loads the contents of the configuration file
+     *
+     * \param   absoluteFilePath        Absolute path to the configuration file
+     * \param   memoryMappingEnabled    Flag which tells if the file can be memory-mapped
+     *
+     * \param[out]  parsedFile      Output for the file information and its contents
+     * \param[out]  errorString     Output for the error description
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    This method can be called from any thread
+     */
+    static bool loadFile(const QString &absoluteFilePath,
+                         const bool memoryMappingEnabled,
+                         ParsedFile *parsedFile,
+                         QString *errorString);
+
+    /*!
+     * Parses the loaded contents of the configuration file
+     *
+     * \param   streamingParserEnabled  Flag which tells if the streaming parser shall be used
+     *
+     * \param[in,out]   parsedFile  Loaded configuration file
+     *
+     * \note    This method can be called from any thread
+     */
+    static void parseFile(const bool streamingParserEnabled, ParsedFile *parsedFile);
+
+    /*!
+     * Starts loading the files of the includes in the include thread pool
+     *
+     * \param   includes                Include parameters
+     * \param   workingDir              Path to the working directory
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Prefetched files for each include (null if the include cannot be prefetched)
+     */
+    std::vector<std::shared_ptr<IncludePrefetch>> prefetchIncludes(
+            const QVector<QJsonObject> &includes,
+            const QDir &workingDir,
+            const EnvironmentVariables &environmentVariables) const;
+
+    /*!
+     * Interns the member name if the name table is set
+     *
+     * \param   name    Member name
+     *
+     * \return  Interned member name or the same member name if the name table is not set
+     */
+    QString internName(const QString &name) const;
+
+    /*!
+     * Creates the arena for the configuration nodes of a read procedure
+     *
+     * \return  Arena (it is active on the current thread) or null if arena allocation is disabled
+     *          or if an arena is already active
+     */
+    std::unique_ptr<ConfigNodeArena> createArena() const;
+
+    /*!
+     * Read the specified config from JSON
+     *
+     * \param   configObject        Configuration data in JSON format
+     * \param   workingDir          Path to the working directory
+     * \param   sourceNodePath      Node path to the node that needs to be extracted from this
+     *                              configuration file (must be absolute node path)
+     * \param   destinationNodePath Node path to the destination node where the result needs to be
+     *                              stored (must be absolute node path)
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     *
+     * \param[in,out]   configMemberReader      Optional reader positioned at the value of the
+     *                                          'config' member (if it is not set then the 'config'
+     *                                          member is taken from configObject)
+     * \param[in,out]   environmentVariables    Environment variables
+     * \param[in,out]   statistics              Optional output for the read statistics
+     * \param[in,out]   dependencies            Optional output for the dependencies of the read
+     *                                          configuration
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> readConfig(
+            const QJsonObject &configObject,
+            JsonStreamReader *configMemberReader,
+            const QDir &workingDir,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables,
+            ReadStatistics *statistics,
+            ConfigIncludeCache::Dependencies *dependencies) const;
+
+    /*!
+     * Scans the root JSON Object of a configuration file with the streaming parser
+     *
+     * \param[in,out]   reader      JSON stream reader
+     * \param[out]      rootObject  Output for the 'environment_variables' and 'includes' members
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (the data is not a JSON Object or it is invalid, see reader)
+     *
+     * The 'config' member is only validated and on success the reader is positioned at its value so
+     * that it can be read directly into configuration nodes later on. If the file does not contain
+     * the 'config' member then the reader is positioned at the end of the data.
+     */
+    static bool scanRootObject(JsonStreamReader *reader, QJsonObject *rootObject);
+
+    /*!
+     * Read the configuration file referenced by the include parameters
+     *
+     * \param   workingDir          Path to the working directory
+     * \param   destinationNodePath Node path to the destination node where the result needs to be
+     *                              stored (must be absolute node path)
+     * \param   otherParameters     Include parameters ('file_path' and optional 'source_node')
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     * \param[in,out]   dependencies            Optional output for the dependencies of the read
+     *                                          configuration
+     * \param[in,out]   prefetch                Optional file loaded in advance
+     *
+     * \param[out]  statistics  Optional output for the read statistics
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     *
+     * If the include cache is set then the configuration is taken from it or stored in it.
+     */
+    std::unique_ptr<ConfigObjectNode> readInclude(
+            const QDir &workingDir,
+            const ConfigNodePath &destinationNodePath,
+            const QJsonObject &otherParameters,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables,
+            ReadStatistics *statistics,
+            ConfigIncludeCache::Dependencies *dependencies,
+            IncludePrefetch *prefetch) const;
+
     /*!
      * Reads the 'environment_variables' member of the configuration file
      *
@@ -146,30 +576,51 @@ private:
      * \param   externalConfigs Configuration nodes provided by an external source
      *
      * \param[in,out]   environmentVariables    Environment variables
+     * \param[in,out]   statistics              Optional output for the read statistics
+     * \param[in,out]   dependencies            Optional output for the dependencies of the read
+     *                                          configuration
      *
      * \return  Configuration node instance or null in case of failure
+     *
+     * The included configurations of the "CppConfigFramework" type are read with this reader
+     * instance (unless a different reader class was registered for that type) so that its settings
+     * also apply to the included configuration files.
      */
     std::unique_ptr<ConfigObjectNode> readIncludesMember(
             const QJsonObject &rootObject,
             const QDir &workingDir,
             const std::vector<const ConfigObjectNode *> &externalConfigs,
-            EnvironmentVariables *environmentVariables) const;
+            EnvironmentVariables *environmentVariables,
+            ReadStatistics *statistics,
+            ConfigIncludeCache::Dependencies *dependencies) const;
 
     /*!
      * Reads the 'config' member of the configuration file
      *
      * \param   rootObject              Root JSON Object
+     * \param   sourceNodePath          Node path to the node that needs to be extracted from the
+     *                                  configuration (used only for partial parsing)
      * \param   externalConfigs         Configuration nodes provided by an external source
      * \param   includesConfig          Configuration node loaded from includes
      * \param   environmentVariables    Environment variables
      *
+     * \param[in,out]   configMemberReader  Optional reader positioned at the value of the 'config'
+     *                                      member (used instead of the member in rootObject)
+     * \param[in,out]   statistics          Optional output for the read statistics
+     * \param[in,out]   dependencies        Optional output for the dependencies of the read
+     *                                      configuration
+     *
      * \return  Configuration node instance or null in case of failure
      */
     std::unique_ptr<ConfigObjectNode> readConfigMember(
             const QJsonObject &rootObject,
+            JsonStreamReader *configMemberReader,
+            const ConfigNodePath &sourceNodePath,
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             const ConfigObjectNode &includesConfig,
-            const EnvironmentVariables &environmentVariables) const;
+            const EnvironmentVariables &environmentVariables,
+            ReadStatistics *statistics,
+            ConfigIncludeCache::Dependencies *dependencies) const;
 
     /*!
      * Reads a Value node from the JSON Value
@@ -188,13 +639,167 @@ private:
      * \param   jsonObject              JSON Object
      * \param   currentNodePath         Current node path
      * \param   environmentVariables    Environment variables
+     * \param   selectedNodePaths       Optional absolute node paths of the nodes to read
+     *                                  (null reads all of the nodes)
+     *
+     * \param[out]  skippedMembers  Optional output for the members that were not selected
      *
      * \return  Configuration node instance or null in case of failure
      */
-    static std::unique_ptr<ConfigObjectNode> readObjectNode(
+    std::unique_ptr<ConfigObjectNode> readObjectNode(
             const QJsonObject &jsonObject,
             const ConfigNodePath &currentNodePath,
-            const EnvironmentVariables &environmentVariables);
+            const EnvironmentVariables &environmentVariables,
+            const std::vector<ConfigNodePath> *selectedNodePaths = nullptr,
+            std::vector<SkippedMember> *skippedMembers = nullptr) const;
+
+    /*!
+     * Reads a member of an Object node from the JSON Value
+     *
+     * \param   jsonValue               JSON Value of the member
+     * \param   decorator               Decorator of the member name
+     * \param   memberNodePath          Absolute node path of the member
+     * \param   selection               Selection of the member (must not be MemberSelection::None)
+     * \param   environmentVariables    Environment variables
+     * \param   selectedNodePaths       Optional absolute node paths of the nodes to read
+     *                                  (null reads all of the nodes)
+     *
+     * \param[out]  skippedMembers  Optional output for the members that were not selected
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigNode> readMemberNode(
+            const QJsonValue &jsonValue,
+            const QChar decorator,
+            const ConfigNodePath &memberNodePath,
+            const MemberSelection selection,
+            const EnvironmentVariables &environmentVariables,
+            const std::vector<ConfigNodePath> *selectedNodePaths,
+            std::vector<SkippedMember> *skippedMembers) const;
+
+    /*!
+     * Reads an Object node directly from the JSON stream
+     *
+     * \param   currentNodePath         Current node path
+     * \param   environmentVariables    Environment variables
+     * \param   selectedNodePaths       Optional absolute node paths of the nodes to read
+     *                                  (null reads all of the nodes)
+     *
+     * \param[in,out]   reader  JSON stream reader positioned at a JSON Object
+     *
+     * \param[out]  skippedMembers  Optional output for the members that were not selected
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> readObjectNode(
+            JsonStreamReader *reader,
+            const ConfigNodePath &currentNodePath,
+            const EnvironmentVariables &environmentVariables,
+            const std::vector<ConfigNodePath> *selectedNodePaths = nullptr,
+            std::vector<SkippedMember> *skippedMembers = nullptr) const;
+
+    /*!
+     * Reads a member of an Object node directly from the JSON stream
+     *
+     * \param   decorator               Decorator of the member name
+     * \param   memberNodePath          Absolute node path of the member
+     * \param   selection               Selection of the member (must not be MemberSelection::None)
+     * \param   environmentVariables    Environment variables
+     * \param   selectedNodePaths       Optional absolute node paths of the nodes to read
+     *                                  (null reads all of the nodes)
+     *
+     * \param[in,out]   reader  JSON stream reader positioned at the member value
+     *
+     * \param[out]  skippedMembers  Optional output for the members that were not selected
+     *
+     * \return  Configuration node instance or null in case of failure (in case reading from the
+     *          stream failed the error is set in the reader)
+     */
+    std::unique_ptr<ConfigNode> readMemberNode(
+            JsonStreamReader *reader,
+            const QChar decorator,
+            const ConfigNodePath &memberNodePath,
+            const MemberSelection selection,
+            const EnvironmentVariables &environmentVariables,
+            const std::vector<ConfigNodePath> *selectedNodePaths,
+            std::vector<SkippedMember> *skippedMembers) const;
+
+    /*!
+     * Reads the skipped members of the 'config' member that are selected now
+     *
+     * \param   environmentVariables    Environment variables
+     * \param   selectedNodePaths       Optional absolute node paths of the nodes to read
+     *                                  (null reads all of the nodes)
+     *
+     * \param[in,out]   configMemberReader  Optional reader of the 'config' member (the skipped
+     *                                      members are read from their offsets)
+     * \param[in,out]   skippedMembers      Skipped members (the read members are removed and the
+     *                                      members skipped inside of them are added)
+     * \param[in,out]   config              Configuration node read from the 'config' member
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * Only the newly selected members are read, the rest of the 'config' member is not parsed
+     * again.
+     */
+    bool readSkippedMembers(JsonStreamReader *configMemberReader,
+                            const EnvironmentVariables &environmentVariables,
+                            const std::vector<ConfigNodePath> *selectedNodePaths,
+                            std::vector<SkippedMember> *skippedMembers,
+                            ConfigObjectNode *config) const;
+
+    /*!
+     * Selects which part of a member needs to be read
+     *
+     * \param   memberNodePath      Absolute node path of the member
+     * \param   selectedNodePaths   Optional absolute node paths of the nodes to read
+     *
+     * \return  Selection of the member
+     */
+    static MemberSelection selectMember(const ConfigNodePath &memberNodePath,
+                                        const std::vector<ConfigNodePath> *selectedNodePaths);
+
+    /*!
+     * Adds the node paths referenced from the read nodes to the selected node paths
+     *
+     * \param   config  Configuration node read with the selected node paths
+     *
+     * \param[in,out]   selectedNodePaths   Selected node paths (they are cleared if the referenced
+     *                                      node paths cannot be determined)
+     *
+     * \retval  true    Selected node paths were changed so the configuration needs to be read again
+     * \retval  false   All of the referenced nodes were already selected
+     */
+    static bool extendNodeSelection(const ConfigObjectNode &config,
+                                    std::vector<ConfigNodePath> *selectedNodePaths);
+
+    /*!
+     * Collects the node paths referenced by the NodeReference and DerivedObject nodes
+     *
+     * \param   node        Configuration node
+     * \param   nodePath    Absolute node path of the configuration node
+     *
+     * \param[out]  referencedNodePaths Output for the normalized absolute referenced node paths
+     *
+     * \retval  true    Success
+     * \retval  false   At least one of the referenced node paths could not be determined
+     */
+    static bool collectReferencedNodePaths(const ConfigNode &node,
+                                           const ConfigNodePath &nodePath,
+                                           std::vector<ConfigNodePath> *referencedNodePaths);
+
+    /*!
+     * Creates the normalized absolute node path of a referenced node
+     *
+     * \param   referenceNodePath   Absolute or relative node path of the referenced node
+     * \param   parentNodePath      Absolute node path of the parent of the referencing node
+     *
+     * \return  Absolute node path without parent node references or an invalid node path if it
+     *          cannot be determined
+     */
+    static ConfigNodePath normalizeReferencedNodePath(const ConfigNodePath &referenceNodePath,
+                                                      const ConfigNodePath &parentNodePath);
 
     /*!
      * Reads a NodeReference node from the JSON String
@@ -217,10 +822,40 @@ private:
      *
      * \return  Configuration node instance or null in case of failure
      */
-    static std::unique_ptr<ConfigDerivedObjectNode> readDerivedObjectNode(
+    std::unique_ptr<ConfigDerivedObjectNode> readDerivedObjectNode(
             const QJsonObject &jsonObject,
             const ConfigNodePath &currentNodePath,
-            const EnvironmentVariables &environmentVariables);
+            const EnvironmentVariables &environmentVariables) const;
+
+    /*!
+     * Reads a DerivedObject node directly from the JSON stream
+     *
+     * \param   currentNodePath         Current node path
+     * \param   environmentVariables    Environment variables
+     *
+     * \param[in,out]   reader  JSON stream reader positioned at a JSON Object
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigDerivedObjectNode> readDerivedObjectNode(
+            JsonStreamReader *reader,
+            const ConfigNodePath &currentNodePath,
+            const EnvironmentVariables &environmentVariables) const;
+
+    /*!
+     * Reads the bases of a DerivedObject node from the value of the 'base' member
+     *
+     * \param   baseValue       Value of the 'base' member
+     * \param   currentNodePath Current node path
+     *
+     * \param[out]  bases   Output for the bases
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    static bool readDerivedObjectBases(const QJsonValue &baseValue,
+                                       const ConfigNodePath &currentNodePath,
+                                       QList<ConfigNodePath> *bases);
 
     /*!
      * Resolves references to environment variables in a JSON Value
@@ -269,6 +904,29 @@ private:
      */
     static bool hasDecorator(const QString &memberName);
 
+    /*!
+     * Counts the configuration nodes in the specified node (including the node itself)
+     *
+     * \param   node    Configuration node
+     *
+     * \return  Number of configuration nodes
+     */
+    static int countNodes(const ConfigNode &node);
+
+    /*!
+     * Creates the absolute path to the configuration file
+     *
+     * \param   filePath                Path to the configuration file (it can contain references
+     *                                  to environment variables)
+     * \param   workingDir              Path to the working directory
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Absolute file path or an empty string if the file path could not be expanded
+     */
+    static QString makeAbsoluteFilePath(const QString &filePath,
+                                        const QDir &workingDir,
+                                        const EnvironmentVariables &environmentVariables);
+
     /*!
      * Sets the current directory environment variable (CPPCONFIGFRAMEWORK_CURRENT_DIR)
      *
@@ -278,6 +936,31 @@ private:
      */
     static void setCurrentDirectory(const QDir &currentDir,
                                     EnvironmentVariables *environmentVariables);
+
+private:
+    //! Holds the flag which tells if configuration files are read with the streaming parser
+    bool m_streamingParserEnabled = false;
+
+    //! Holds the flag which tells if configuration files are memory-mapped
+    bool m_memoryMappingEnabled = false;
+
+    //! Holds the include cache
+    std::shared_ptr<ConfigIncludeCache> m_includeCache;
+
+    //! Holds the flag which tells if included configuration files are loaded in parallel
+    bool m_parallelIncludesEnabled = false;
+
+    //! Holds the thread pool used for loading of included configuration files in parallel
+    QThreadPool *m_includeThreadPool = nullptr;
+
+    //! Holds the flag which tells if only the needed parts of the 'config' member are read
+    bool m_partialParsingEnabled = false;
+
+    //! Holds the name table
+    std::shared_ptr<ConfigNameTable> m_nameTable;
+
+    //! Holds the flag which tells if the configuration nodes are allocated from an arena
+    bool m_arenaAllocationEnabled = false;
 };
 
 } // namespace CppConfigFramework
@@ -23,6 +23,7 @@
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigNode.hpp>
 #include <CppConfigFramework/EnvironmentVariables.hpp>
+#include <CppConfigFramework/ReadStatistics.hpp>
 
 // Qt includes
 #include <QtCore/QDir>
@@ -30,6 +31,10 @@
 // System includes
 
 // Forward declarations
+namespace CppConfigFramework
+{
+class ConfigIncludeCache;
+}
 
 // Macros
 
@@ -42,6 +47,16 @@ namespace CppConfigFramework
 class CPPCONFIGFRAMEWORK_EXPORT ConfigReaderBase
 {
 public:
+    //! Holds a lookup of a referenced node in the configuration nodes provided by an external source
+    struct ExternalNodeLookup
+    {
+        //! Reference to the configuration node
+        ConfigNodePath referenceNodePath;
+
+        //! Node path of the parent of the referencing node
+        ConfigNodePath parentNodePath;
+    };
+
     //! Constructor
     ConfigReaderBase() = default;
 
@@ -64,6 +79,9 @@ public:
      * Gets the max number of cycles for reference resolution procedure
      *
      * \return  Max number of cycles
+     *
+     * \note    References are resolved in a single pass in the order of their dependencies so the
+     *          limit is only reported in the read statistics
      */
     uint32_t referenceResolutionMaxCycles() const;
 
@@ -71,6 +89,9 @@ public:
      * Sets the max number of cycles for reference resolution procedure
      *
      * \param   referenceResolutionMaxCycles    New max number of cycles
+     *
+     * \note    The limit is not enforced, it is kept only for compatibility and reported in the
+     *          read statistics (see ReadStatistics::referenceResolutionMaxCycles)
      */
     void setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles);
 
@@ -98,16 +119,6 @@ public:
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             EnvironmentVariables *environmentVariables) const = 0;
 
-protected:
-    //! Enumerates the possible results of reference resolution procedure
-    enum class ReferenceResolutionResult
-    {
-        Resolved,           //!< There were either no references or they were all resolved
-        PartiallyResolved,  //!< At least one of the references was resolved, but not all of them
-        Unchanged,          //!< None of the references were resolved
-        Error               //!< An error occurred
-    };
-
 protected:
     /*!
      * Checks if the node is fully resolved (has no unresolved references)
@@ -133,77 +144,41 @@ protected:
      *
      * \param   externalConfigs     Configuration nodes provided by an external source
      *
-     * \param[in,out]   config  Configuration node
+     * \param[in,out]   config      Configuration node
+     * \param[in,out]   statistics  Optional output for the read statistics
      *
-     * \return  Reference resolution result
-     */
-    bool resolveReferences(const std::vector<const ConfigObjectNode *> &externalConfigs,
-                           ConfigObjectNode *config) const;
-
-    /*!
-     * Tries to resolve all references in the specified Object node
-     *
-     * \param   externalConfigs     Configuration nodes provided by an external source
+     * \param[out]  externalNodeLookups Optional output for the lookups of the referenced nodes in the
+     *                                  external configuration nodes
      *
-     * \param[in,out]   node    Configuration node
+     * \retval  true    Success
+     * \retval  false   Failure
      *
-     * \return  Reference resolution result
+     * The references are resolved in a single pass in the order of their dependencies: before a
+     * reference is resolved all of the references that it depends on (references on the node path to
+     * the referenced node and inside the referenced node) are resolved first. A reference that
+     * (indirectly) depends on itself is reported as a reference cycle.
      */
-    static ReferenceResolutionResult resolveObjectReferences(
-            const std::vector<const ConfigObjectNode *> &externalConfigs,
-            ConfigObjectNode *node);
-
-    /*!
-     * Updates the reference resolution result
-     *
-     * \param   currentResult   Current result
-     * \param   newResult       New result
-     *
-     * \return  Updated result
-     */
-    static ReferenceResolutionResult updateObjectResolutionResult(
-            const ReferenceResolutionResult currentResult,
-            const ReferenceResolutionResult newResult);
-
-    /*!
-     * Tries to resolve the reference in the specified NodeReference node
-     *
-     * \param   externalConfigs     Configuration nodes provided by an external source
-     *
-     * \param[in,out]   node    Configuration node
-     *
-     * \return  Reference resolution result
-     */
-    static ReferenceResolutionResult resolveNodeReference(
-            const std::vector<const ConfigObjectNode *> &externalConfigs,
-            ConfigNodeReference *node);
-
-    /*!
-     * Tries to resolve all references in the specified DerivedObject node
-     *
-     * \param   externalConfigs     Configuration nodes provided by an external source
-     *
-     * \param[in,out]   node    Configuration node
-     *
-     * \return  Reference resolution result
-     */
-    static ReferenceResolutionResult resolveDerivedObjectReferences(
-            const std::vector<const ConfigObjectNode *> &externalConfigs,
-            ConfigDerivedObjectNode *node);
+    bool resolveReferences(const std::vector<const ConfigObjectNode *> &externalConfigs,
+                           ConfigObjectNode *config,
+                           ReadStatistics *statistics = nullptr,
+                           std::vector<ExternalNodeLookup> *externalNodeLookups = nullptr) const;
 
     /*!
-     * Try to find the referenced configuration node from the parent and as an alternative from the
-     * configuration nodes provided by an external source
+     * Tries to find the referenced configuration node in the configuration nodes provided by an
+     * external source
      *
      * \param   referenceNodePath   Reference to the configuration node
-     * \param   parentNode          Parent configuration node
+     * \param   parentNodePath      Node path of the parent of the referencing node
      * \param   externalConfigs     Configuration nodes provided by an external source
      *
      * \return  Referenced configuration node or null in case the node was not found
+     *
+     * \note    In case the node is found in multiple external configuration nodes the last found
+     *          node is used
      */
-    static const ConfigNode *findReferencedConfigNode(
+    static const ConfigNode *findExternalConfigNode(
             const ConfigNodePath &referenceNodePath,
-            const ConfigObjectNode &parentNode,
+            const ConfigNodePath &parentNodePath,
             const std::vector<const ConfigObjectNode *> &externalConfigs);
 
     /*!
@@ -223,6 +198,13 @@ protected:
             const ConfigNodePath &sourceNodePath,
             const ConfigNodePath &destinationNodePath);
 
+private:
+    //! The include cache checks the external node lookups of the cached configurations
+    friend class ConfigIncludeCache;
+
+    //! Resolves the references of a configuration node in the order of their dependencies
+    class ReferenceResolver;
+
 private:
     //! Holds the default value for max number of cycles for reference resolution procedure
     static constexpr uint32_t m_defaultReferenceResolutionMaxCycles = 100U;
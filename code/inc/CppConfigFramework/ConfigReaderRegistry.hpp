@@ -75,6 +75,15 @@ public:
     bool registerConfigReader(const QString &type,
                               std::unique_ptr<ConfigReaderBase> configReader);
 
+    /*!
+     * Gets the configuration reader registered for the specified type
+     *
+     * \param   type    Configuration reader type
+     *
+     * \return  Configuration reader instance or a null pointer if the type is not supported
+     */
+    const ConfigReaderBase *configReader(const QString &type) const;
+
     /*!
      * Read the specified configuration
      *
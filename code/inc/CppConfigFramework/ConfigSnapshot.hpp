@@ -0,0 +1,339 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for the binary snapshots of resolved configurations
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+
+// Qt includes
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+
+// System includes
+#include <cstdint>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds a binary snapshot of a resolved configuration (a configuration that contains
+ * only Object and Value nodes)
+ *
+ * A snapshot is a compact binary representation of the configuration:
+ * - Header
+ * - String table (member names and string values in UTF-8 format)
+ * - Node table (fixed size records with the node type, name, parent and value)
+ * - Member table (node indexes of the members of each Object node sorted by name)
+ * - Value blobs (JSON Arrays and JSON Objects stored in Value nodes in compact JSON format)
+ *
+ * A snapshot file is memory-mapped when it is opened. The read-only view (Node) looks up the nodes
+ * and decodes their values directly in the mapped data, so reading individual parameters does not
+ * create any configuration nodes. Since the file is mapped read-only it is shared between the
+ * processes through the page cache.
+ *
+ * ConfigItem::loadConfig() only works with configuration nodes, so loading a configuration item
+ * from a snapshot requires converting the view to configuration nodes with toConfigNode(). This
+ * copies the converted nodes out of the snapshot, so only the subtree that is needed by the item
+ * should be converted (see Node::nodeAtPath() and Node::toConfigNode()).
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigSnapshot
+{
+public:
+    //! Read-only view of a configuration node in the snapshot
+    class CPPCONFIGFRAMEWORK_EXPORT Node
+    {
+    public:
+        //! Constructor (invalid node)
+        Node() = default;
+
+        /*!
+         * Checks if the node is valid
+         *
+         * \retval  true    Valid
+         * \retval  false   Invalid
+         */
+        bool isValid() const;
+
+        /*!
+         * Gets the type of the node
+         *
+         * \return  Node type (Object or Value)
+         */
+        ConfigNode::Type type() const;
+
+        /*!
+         * Checks if this is an Object node
+         *
+         * \retval  true    Object node
+         * \retval  false   Some other node type
+         */
+        bool isObject() const;
+
+        /*!
+         * Checks if this is a Value node
+         *
+         * \retval  true    Value node
+         * \retval  false   Some other node type
+         */
+        bool isValue() const;
+
+        /*!
+         * Checks if this is the root node
+         *
+         * \retval  true    Root node
+         * \retval  false   Not a root node
+         */
+        bool isRoot() const;
+
+        /*!
+         * Gets the parent of the node
+         *
+         * \return  Parent node or an invalid node in case of the root node
+         */
+        Node parent() const;
+
+        /*!
+         * Gets the name of the node
+         *
+         * \return  Node name (empty string for the root node)
+         */
+        QString nodeName() const;
+
+        /*!
+         * Gets the absolute node path of the node
+         *
+         * \return  Node path
+         */
+        ConfigNodePath nodePath() const;
+
+        /*!
+         * Gets the number of members of an Object node
+         *
+         * \return  Number of members (0 for a Value node)
+         */
+        int count() const;
+
+        /*!
+         * Gets the names of the members of an Object node
+         *
+         * \return  Sorted list of member names
+         */
+        QStringList names() const;
+
+        /*!
+         * Checks if an Object node contains a member with the specified name
+         *
+         * \param   name    Member name
+         *
+         * \retval  true    Member found
+         * \retval  false   Member not found
+         */
+        bool contains(const QString &name) const;
+
+        /*!
+         * Gets a member of an Object node
+         *
+         * \param   name    Member name
+         *
+         * \return  Member node or an invalid node if it was not found
+         *
+         * \note    Members are found with a binary search directly in the snapshot data
+         */
+        Node member(const QString &name) const;
+
+        /*!
+         * Gets a member of an Object node
+         *
+         * \param   index   Index of the member (members are sorted by name)
+         *
+         * \return  Member node or an invalid node if the index is out of range
+         */
+        Node memberAt(const int index) const;
+
+        /*!
+         * Gets the node at the specified path
+         *
+         * \param   nodePath    Absolute or relative node path
+         *
+         * \return  Node or an invalid node if it was not found
+         */
+        Node nodeAtPath(const ConfigNodePath &nodePath) const;
+
+        /*!
+         * Gets the value of a Value node
+         *
+         * \return  Value or an undefined value for Object nodes
+         *
+         * \note    Scalar values are decoded directly from the node record, JSON Arrays and JSON
+         *          Objects are parsed from their blob on each call
+         */
+        QJsonValue value() const;
+
+        /*!
+         * Converts the node (with its subtree) to a configuration node
+         *
+         * \return  Configuration node or null in case of failure
+         *
+         * \note    All nodes in the subtree are copied out of the snapshot (the JSON Arrays and
+         *          JSON Objects are parsed from their blobs) and the returned node is the root node
+         *          of the copy
+         */
+        std::unique_ptr<ConfigNode> toConfigNode() const;
+
+    private:
+        //! ConfigSnapshot creates the nodes
+        friend class ConfigSnapshot;
+
+        /*!
+         * Constructor
+         *
+         * \param   data    Snapshot data
+         * \param   index   Node index
+         */
+        Node(const char *data, const uint32_t index);
+
+        //! Holds the snapshot data
+        const char *m_data = nullptr;
+
+        //! Holds the node index
+        uint32_t m_index = 0U;
+    };
+
+    //! Constructor
+    ConfigSnapshot() = default;
+
+    //! Copy constructor is disabled
+    ConfigSnapshot(const ConfigSnapshot &) = delete;
+
+    //! Move constructor
+    ConfigSnapshot(ConfigSnapshot &&) noexcept = default;
+
+    //! Destructor
+    ~ConfigSnapshot();
+
+    //! Copy assignment operator is disabled
+    ConfigSnapshot &operator=(const ConfigSnapshot &) = delete;
+
+    //! Move assignment operator
+    ConfigSnapshot &operator=(ConfigSnapshot &&) noexcept = default;
+
+    /*!
+     * Creates the snapshot data of a resolved configuration
+     *
+     * \param   config  Configuration node (only Object and Value nodes are supported)
+     *
+     * \return  Snapshot data or an empty byte array in case of failure
+     */
+    static QByteArray serialize(const ConfigObjectNode &config);
+
+    /*!
+     * Writes the snapshot of a resolved configuration to a file
+     *
+     * \param   config      Configuration node (only Object and Value nodes are supported)
+     * \param   filePath    Path to the snapshot file
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    static bool write(const ConfigObjectNode &config, const QString &filePath);
+
+    /*!
+     * Opens the snapshot file by memory-mapping it
+     *
+     * \param   filePath    Path to the snapshot file
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    All of the tables in the snapshot are validated before the snapshot is used
+     */
+    bool open(const QString &filePath);
+
+    /*!
+     * Opens the snapshot data from memory
+     *
+     * \param   data    Snapshot data
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool open(const QByteArray &data);
+
+    //! Closes the snapshot (all of its nodes become invalid)
+    void close();
+
+    /*!
+     * Checks if the snapshot is opened
+     *
+     * \retval  true    Snapshot is opened
+     * \retval  false   Snapshot is not opened
+     */
+    bool isOpen() const;
+
+    /*!
+     * Gets the root node of the snapshot
+     *
+     * \return  Root node or an invalid node if the snapshot is not opened
+     *
+     * \note    Nodes are valid only while the snapshot is opened
+     */
+    Node rootNode() const;
+
+    /*!
+     * Converts the whole snapshot to a configuration node
+     *
+     * \return  Configuration node or null in case of failure
+     *
+     * \note    This copies the whole configuration out of the snapshot, see Node::toConfigNode()
+     *          for converting just a subtree
+     */
+    std::unique_ptr<ConfigObjectNode> toConfigNode() const;
+
+private:
+    /*!
+     * Validates the snapshot data
+     *
+     * \param   data    Snapshot data
+     * \param   size    Size of the snapshot data
+     *
+     * \retval  true    Valid
+     * \retval  false   Invalid
+     */
+    static bool validate(const char *data, const qint64 size);
+
+private:
+    //! Holds the memory-mapped snapshot file
+    std::unique_ptr<QFile> m_file;
+
+    //! Holds the snapshot data opened from memory
+    QByteArray m_buffer;
+
+    //! Holds the pointer to the snapshot data
+    const char *m_data = nullptr;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,250 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains classes for tracing of the configuration loading in the Chrome trace-event format
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+
+// System includes
+#include <atomic>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class collects trace events of the configuration loading
+ *
+ * Tracing is disabled by default. When enabled the configuration readers and configuration items
+ * record spans (for example for each read file, include, reference resolution cycle, DerivedObject
+ * node and loaded configuration structure) which can be written in the Chrome trace-event format
+ * and opened in "chrome://tracing" or Perfetto.
+ *
+ * \note    The events are collected from all threads
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigTracer
+{
+public:
+    //! Copy constructor is disabled
+    ConfigTracer(const ConfigTracer &) = delete;
+
+    //! Move constructor is disabled
+    ConfigTracer(ConfigTracer &&) = delete;
+
+    //! Destructor
+    ~ConfigTracer() = default;
+
+    //! Copy constructor is disabled
+    ConfigTracer &operator=(const ConfigTracer &) = delete;
+
+    //! Move constructor is disabled
+    ConfigTracer &operator=(ConfigTracer &&) = delete;
+
+    /*!
+     * Gets the tracer instance
+     *
+     * \return  Tracer instance
+     */
+    static ConfigTracer *instance();
+
+    /*!
+     * Checks if tracing is enabled
+     *
+     * \retval  true    Enabled
+     * \retval  false   Disabled
+     */
+    bool isEnabled() const;
+
+    /*!
+     * Enables or disables tracing
+     *
+     * \param   enabled New value
+     */
+    void setEnabled(const bool enabled);
+
+    //! Removes all recorded events
+    void clear();
+
+    /*!
+     * Gets the number of recorded events
+     *
+     * \return  Number of recorded events
+     */
+    int eventCount() const;
+
+    /*!
+     * Gets the current timestamp
+     *
+     * \return  Time in nanoseconds since the creation of the tracer
+     */
+    qint64 timestamp() const;
+
+    /*!
+     * Records a complete event (a span with a start time and a duration)
+     *
+     * \param   category    Event category
+     * \param   name        Event name
+     * \param   startTime   Start time of the span (see timestamp())
+     * \param   duration    Duration of the span in nanoseconds
+     * \param   arguments   Optional event arguments
+     *
+     * \note    The event is recorded only if tracing is enabled
+     */
+    void addCompleteEvent(const QString &category,
+                          const QString &name,
+                          const qint64 startTime,
+                          const qint64 duration,
+                          const QJsonObject &arguments = QJsonObject());
+
+    /*!
+     * Converts the recorded events to the Chrome trace-event format
+     *
+     * \return  JSON document
+     */
+    QJsonDocument toChromeTrace() const;
+
+    /*!
+     * Writes the recorded events in the Chrome trace-event format to the specified file
+     *
+     * \param   filePath    Path to the output file
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool writeChromeTrace(const QString &filePath) const;
+
+private:
+    //! Constructor
+    ConfigTracer();
+
+    /*!
+     * Gets the trace thread ID of the current thread (must be called with a locked mutex)
+     *
+     * \return  Trace thread ID
+     */
+    int currentThreadId();
+
+private:
+    //! Holds the flag that indicates if tracing is enabled
+    std::atomic<bool> m_enabled;
+
+    //! Holds the timer used for the timestamps
+    QElapsedTimer m_timer;
+
+    //! Holds the mutex that protects the recorded events
+    mutable QMutex m_mutex;
+
+    //! Holds the recorded events
+    QJsonArray m_events;
+
+    //! Holds the trace thread IDs
+    QHash<Qt::HANDLE, int> m_threadIds;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class records a span for the lifetime of its instance
+ *
+ * The span is recorded only if tracing was enabled when the instance was created.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigTraceSpan
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   category    Span category
+     * \param   name        Span name
+     */
+    ConfigTraceSpan(const QString &category, const QString &name);
+
+    //! Copy constructor is disabled
+    ConfigTraceSpan(const ConfigTraceSpan &) = delete;
+
+    //! Move constructor is disabled
+    ConfigTraceSpan(ConfigTraceSpan &&) = delete;
+
+    //! Destructor (records the span)
+    ~ConfigTraceSpan();
+
+    //! Copy constructor is disabled
+    ConfigTraceSpan &operator=(const ConfigTraceSpan &) = delete;
+
+    //! Move constructor is disabled
+    ConfigTraceSpan &operator=(ConfigTraceSpan &&) = delete;
+
+    /*!
+     * Checks if the span is active (tracing was enabled when the span was created)
+     *
+     * \retval  true    Active
+     * \retval  false   Inactive
+     *
+     * \note    This can be used to skip preparation of the arguments when tracing is disabled
+     */
+    bool isActive() const;
+
+    /*!
+     * Sets the name of the span
+     *
+     * \param   name    Span name
+     *
+     * \note    This can be used to give the span a more descriptive name (for example with a file
+     *          path) only when the span is active
+     */
+    void setName(const QString &name);
+
+    /*!
+     * Sets an argument of the span
+     *
+     * \param   name    Argument name
+     * \param   value   Argument value
+     */
+    void setArgument(const QString &name, const QJsonValue &value);
+
+private:
+    //! Holds the span category
+    QString m_category;
+
+    //! Holds the span name
+    QString m_name;
+
+    //! Holds the start time of the span (negative value for an inactive span)
+    qint64 m_startTime;
+
+    //! Holds the span arguments
+    QJsonObject m_arguments;
+};
+
+} // namespace CppConfigFramework
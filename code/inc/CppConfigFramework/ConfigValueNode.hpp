@@ -24,8 +24,11 @@
 #include <CppConfigFramework/ConfigNode.hpp>
 
 // Qt includes
+#include <QtCore/QString>
 
 // System includes
+#include <algorithm>
+#include <cstddef>
 
 // Forward declarations
 
@@ -36,7 +39,16 @@
 namespace CppConfigFramework
 {
 
-//! This class holds the Value configuration node
+/*!
+ * This class holds the Value configuration node
+ *
+ * The value is not stored as a QJsonValue but in a compact form from which a QJsonValue is created
+ * on demand:
+ * - Null values, Booleans and numbers are stored inline
+ * - Short strings with only Latin-1 characters are stored inline
+ * - Other strings are stored as implicitly shared QString objects
+ * - JSON Arrays and Objects are stored in an immutable value shared between the clones of the node
+ */
 class CPPCONFIGFRAMEWORK_EXPORT ConfigValueNode : public ConfigNode
 {
 public:
@@ -52,24 +64,16 @@ public:
     ConfigValueNode(const ConfigValueNode &) = delete;
 
     //! Move constructor
-#if QT_VERSION < QT_VERSION_CHECK(5, 10, 0)
-    ConfigValueNode(ConfigValueNode &&) = default;
-#else
-    ConfigValueNode(ConfigValueNode &&) noexcept = default;
-#endif
+    ConfigValueNode(ConfigValueNode &&other) noexcept;
 
     //! Destructor
-    ~ConfigValueNode() override = default;
+    ~ConfigValueNode() override;
 
     //! Copy assignment operator is disabled
     ConfigValueNode &operator=(const ConfigValueNode &) = delete;
 
     //! Move assignment operator
-#if QT_VERSION < QT_VERSION_CHECK(5, 10, 0)
-    ConfigValueNode &operator=(ConfigValueNode &&) = default;
-#else
-    ConfigValueNode &operator=(ConfigValueNode &&) noexcept = default;
-#endif
+    ConfigValueNode &operator=(ConfigValueNode &&other) noexcept;
 
     //! \copydoc    ConfigNode::clone()
     std::unique_ptr<ConfigNode> clone() const override;
@@ -91,9 +95,107 @@ public:
      */
     void setValue(const QJsonValue &value);
 
+    /*!
+     * Sets the value of the configuration node to the value of the other node
+     *
+     * \param   other   Configuration node with the new value
+     *
+     * \note    The value is copied without converting it to a QJsonValue
+     */
+    void setValue(const ConfigValueNode &other);
+
 private:
-    //! Configuration node's value
-    QJsonValue m_value;
+    //! Enumerates the forms in which the value is stored
+    enum class Storage : quint8
+    {
+        //! Undefined value
+        Undefined,
+
+        //! Null value
+        Null,
+
+        //! Boolean value stored inline
+        Bool,
+
+        //! Number stored inline
+        Double,
+
+        //! String with only Latin-1 characters stored inline
+        ShortString,
+
+        //! String stored as a QString object
+        String,
+
+        //! JSON Array or Object stored in a shared value
+        Composite
+    };
+
+    //! Holds a JSON Array or Object shared between the clones of a node
+    struct SharedValue;
+
+    /*!
+     * Stores the value (the node must not hold a value)
+     *
+     * \param   value   Value to store
+     */
+    void assign(const QJsonValue &value);
+
+    /*!
+     * Stores a copy of the other node's value (the node must not hold a value)
+     *
+     * \param   other   Configuration node with the value to store
+     */
+    void assign(const ConfigValueNode &other);
+
+    /*!
+     * Takes over the other node's value (the node must not hold a value)
+     *
+     * \param   other   Configuration node with the value to take over (it is left undefined)
+     */
+    void moveFrom(ConfigValueNode &other) noexcept;
+
+    //! Releases the stored value (the value becomes undefined)
+    void reset() noexcept;
+
+    /*!
+     * Gets the stored QString object
+     *
+     * \return  Stored QString object (valid only for the String storage)
+     */
+    const QString *string() const;
+
+    //! \copydoc    ConfigValueNode::string()
+    QString *string();
+
+    /*!
+     * Gets the stored shared value
+     *
+     * \return  Stored shared value (valid only for the Composite storage)
+     */
+    SharedValue *sharedValue() const;
+
+private:
+    /*!
+     * Size of the stored value (it fits a QString object, a pointer and a double, but at least 15
+     * bytes so that a short string can hold 14 characters even if those types are smaller)
+     */
+    static constexpr int DATA_SIZE =
+            static_cast<int>(std::max({ sizeof(QString), sizeof(void *), sizeof(double),
+                                        static_cast<std::size_t>(15U) }));
+
+    //! Max number of characters of a short string (its size is held in the last byte of the value)
+    static constexpr int SHORT_STRING_CAPACITY = DATA_SIZE - 1;
+
+    static_assert(SHORT_STRING_CAPACITY <= 127, "Size of a short string does not fit in a byte");
+
+    /*!
+     * Stored value (depending on the storage it holds a bool, a double, a QString object, a pointer
+     * to the shared value or the Latin-1 characters and the size of a short string)
+     */
+    alignas(QString) alignas(void *) alignas(double) char m_data[DATA_SIZE];
+
+    //! Form in which the value is stored
+    Storage m_storage;
 };
 
 } // namespace CppConfigFramework
@@ -25,8 +25,10 @@
 
 // Qt includes
 #include <QtCore/QHash>
+#include <QtCore/QSet>
 
 // System includes
+#include <vector>
 
 // Forward declarations
 
@@ -102,9 +104,48 @@ public:
      */
     QString expandText(const QString &text) const;
 
+    //! Holds the names of the environment variables accessed while recording was active
+    struct AccessRecord
+    {
+        //! Names of the environment variables which were read before they were set
+        QSet<QString> readNames;
+
+        //! Names of the environment variables which were set
+        QSet<QString> writtenNames;
+    };
+
+    /*!
+     * Starts recording of the accessed environment variables
+     *
+     * Recordings can be nested. When a nested recording is stopped its accessed environment
+     * variables are also added to the enclosing recording.
+     *
+     * \note    Only the contains(), value() and setValue() methods (and the methods using them) are
+     *          recorded
+     */
+    void startAccessRecording();
+
+    /*!
+     * Stops the last started recording of the accessed environment variables
+     *
+     * \return  Accessed environment variables
+     */
+    AccessRecord stopAccessRecording();
+
+private:
+    /*!
+     * Records the read access to an environment variable (if recording is active)
+     *
+     * \param   name    Environment variable name
+     */
+    void recordRead(const QString &name) const;
+
 private:
     //! Holds the local environment variables
     QHash<QString, QString> m_variables;
+
+    //! Holds the stack of the active access recordings
+    mutable std::vector<AccessRecord> m_accessRecords;
 };
 
 } // namespace CppConfigFramework
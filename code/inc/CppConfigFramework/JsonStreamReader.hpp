@@ -0,0 +1,282 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for reading JSON data directly from a byte stream
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QByteArray>
+#include <QtCore/QJsonValue>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class reads JSON data (UTF-8 encoded) directly from a byte stream without building a
+ * QJsonDocument for the whole data
+ *
+ * It is a "pull" reader: the user walks through the JSON Objects member by member and decides for
+ * each member value if it should be read as a JSON Value, skipped or processed in some other way
+ * (for example by reading the members of a nested JSON Object with beginObject() and nextMember()).
+ *
+ * Example:
+ * \code
+ * JsonStreamReader reader(data);
+ *
+ * if (reader.beginObject())
+ * {
+ *     QString name;
+ *
+ *     while (reader.nextMember(&name))
+ *     {
+ *         const QJsonValue value = reader.readValue();
+ *         ...
+ *     }
+ * }
+ *
+ * if (reader.hasError())
+ * {
+ *     ...
+ * }
+ * \endcode
+ *
+ * \note    The reader does not copy the data so it must outlive the reader!
+ */
+class CPPCONFIGFRAMEWORK_EXPORT JsonStreamReader
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   data    Pointer to the JSON data
+     * \param   size    Size of the JSON data
+     */
+    JsonStreamReader(const char *data, const int size);
+
+    /*!
+     * Constructor
+     *
+     * \param   data    JSON data
+     */
+    explicit JsonStreamReader(const QByteArray &data);
+
+    //! Copy constructor
+    JsonStreamReader(const JsonStreamReader &) = default;
+
+    //! Move constructor
+    JsonStreamReader(JsonStreamReader &&) noexcept = default;
+
+    //! Destructor
+    ~JsonStreamReader() = default;
+
+    //! Copy assignment operator
+    JsonStreamReader &operator=(const JsonStreamReader &) = default;
+
+    //! Move assignment operator
+    JsonStreamReader &operator=(JsonStreamReader &&) noexcept = default;
+
+    /*!
+     * Checks if an error occurred while reading the data
+     *
+     * \retval  true    An error occurred
+     * \retval  false   No error occurred
+     */
+    bool hasError() const;
+
+    /*!
+     * Gets the description of the error
+     *
+     * \return  Error description or an empty string if no error occurred
+     */
+    QString errorString() const;
+
+    /*!
+     * Gets the offset in the data where the error occurred
+     *
+     * \return  Error offset or -1 if no error occurred
+     */
+    int errorOffset() const;
+
+    /*!
+     * Gets the current read offset in the data
+     *
+     * \return  Read offset
+     */
+    int offset() const;
+
+    /*!
+     * Sets the current read offset in the data
+     *
+     * \param   offset  New read offset (it should point to the start of a JSON Value)
+     *
+     * \note    This also clears the error and the state of the currently read JSON Object
+     */
+    void setOffset(const int offset);
+
+    /*!
+     * Reads the end of the data (only whitespace is allowed after the last read JSON Value)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (there is still something left to read in the data)
+     */
+    bool readEnd();
+
+    /*!
+     * Peeks at the type of the next JSON Value without reading it
+     *
+     * \return  Type of the next JSON Value or QJsonValue::Undefined if the next character does not
+     *          start a JSON Value (or in case an error already occurred)
+     *
+     * \note    JSON Numbers are reported as the QJsonValue::Double type
+     */
+    QJsonValue::Type peekType();
+
+    /*!
+     * Reads the start of a JSON Object
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (the next JSON Value is not a JSON Object)
+     *
+     * After the start of the JSON Object is read its members need to be read with nextMember().
+     */
+    bool beginObject();
+
+    /*!
+     * Reads the name of the next member of the current JSON Object
+     *
+     * \param[out]  name    Name of the member (can be null if the name is not needed)
+     *
+     * \retval  true    Member name was read and its value needs to be read (or skipped) next
+     * \retval  false   End of the JSON Object was reached or an error occurred (see hasError())
+     */
+    bool nextMember(QString *name);
+
+    /*!
+     * Reads the next JSON Value
+     *
+     * \return  JSON Value or QJsonValue::Undefined in case of failure
+     */
+    QJsonValue readValue();
+
+    /*!
+     * Skips the next JSON Value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    The skipped JSON Value is still completely validated
+     */
+    bool skipValue();
+
+private:
+    /*!
+     * Skips whitespace characters
+     *
+     * \retval  true    A non-whitespace character was found
+     * \retval  false   End of data was reached
+     */
+    bool skipWhitespace();
+
+    /*!
+     * Reads a JSON String
+     *
+     * \param[out]  value   Output for the string (can be null if only validation is needed)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readString(QString *value);
+
+    /*!
+     * Reads a JSON Number
+     *
+     * \param[out]  value   Output for the number (can be null if only validation is needed)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readNumber(double *value);
+
+    /*!
+     * Reads a literal (true, false or null)
+     *
+     * \param   literal Expected literal
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readLiteral(const char *literal);
+
+    /*!
+     * Reads or skips the next JSON Value
+     *
+     * \param[out]  value   Output for the value (null if the value only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readOrSkipValue(QJsonValue *value);
+
+    /*!
+     * Sets the error
+     *
+     * \param   errorString Error description
+     *
+     * \return  Always false
+     */
+    bool setError(const char *errorString);
+
+private:
+    //! Max nesting depth of JSON Objects and Arrays (same as in QJsonDocument)
+    static constexpr int m_maxDepth = 1024;
+
+    //! Holds the pointer to the JSON data
+    const char *m_data;
+
+    //! Holds the size of the JSON data
+    int m_size;
+
+    //! Holds the current read offset
+    int m_offset = 0;
+
+    //! Holds the current nesting depth of JSON Objects and Arrays
+    int m_depth = 0;
+
+    //! Holds the flag which tells if the next member is the first member of the current JSON Object
+    bool m_firstMember = false;
+
+    //! Holds the error description
+    const char *m_errorString = nullptr;
+
+    //! Holds the offset where the error occurred
+    int m_errorOffset = -1;
+};
+
+} // namespace CppConfigFramework
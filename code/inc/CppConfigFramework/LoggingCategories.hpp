@@ -52,6 +52,9 @@ CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigParameterValidator
 //! Logging category for ConfigReader
 CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigReader;
 
+//! Logging category for ConfigSnapshot
+CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigSnapshot;
+
 //! Logging category for ConfigWriter
 CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigWriter;
 
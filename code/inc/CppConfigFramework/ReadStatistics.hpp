@@ -0,0 +1,126 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a structure for holding statistics of a configuration read procedure
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QJsonObject>
+
+// System includes
+#include <cstdint>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This structure holds the statistics of a configuration read procedure
+ *
+ * All times are wall clock times in nanoseconds and they are recorded only for the phases of the
+ * top-level configuration (the time spent reading the included configuration files is part of the
+ * includes phase). The counters are accumulated over the top-level configuration and all of its
+ * includes.
+ */
+struct CPPCONFIGFRAMEWORK_EXPORT ReadStatistics
+{
+    //! Time spent reading and parsing the configuration file contents
+    qint64 parseTime = 0;
+
+    //! Time spent reading the 'environment_variables' member
+    qint64 environmentVariablesTime = 0;
+
+    //! Time spent reading the 'includes' member (including the included configuration files)
+    qint64 includesTime = 0;
+
+    //! Time spent creating the configuration nodes from the 'config' member
+    qint64 configTime = 0;
+
+    //! Time spent resolving references in the 'config' member
+    qint64 referenceResolutionTime = 0;
+
+    //! Time spent applying the 'config' member to the configuration read from the includes
+    qint64 applyTime = 0;
+
+    //! Time spent transforming the configuration based on the source and destination node paths
+    qint64 transformTime = 0;
+
+    //! Total time of the read procedure
+    qint64 totalTime = 0;
+
+    //! Number of parsed bytes from configuration files
+    qint64 bytesParsed = 0;
+
+    //! Number of configuration nodes created from the 'config' members
+    int nodesCreated = 0;
+
+    //! Number of read included configurations
+    int includeFiles = 0;
+
+    //! Number of included configurations taken from the include cache
+    int includeCacheHits = 0;
+
+    /*!
+     * Number of reference resolution cycles (sum of all reference resolution procedures)
+     *
+     * \note    Each reference resolution procedure resolves all of its references in a single pass
+     *          so this is the number of the procedures
+     */
+    uint32_t referenceResolutionCycles = 0U;
+
+    //! Highest number of cycles used by a single reference resolution procedure (always 1)
+    uint32_t referenceResolutionMaxCyclesUsed = 0U;
+
+    /*!
+     * Max number of cycles configured in the reader
+     *
+     * \note    This is only a statistic, the limit is not enforced by the reference resolution
+     */
+    uint32_t referenceResolutionMaxCycles = 0U;
+
+    //! Number of subtree copies (cloned and applied configuration nodes)
+    int clonesPerformed = 0;
+
+    //! Resets all times and counters
+    void reset();
+
+    /*!
+     * Accumulates the counters (but not the times) from the other statistics
+     *
+     * \param   other   Other statistics
+     */
+    void mergeCounters(const ReadStatistics &other);
+
+    /*!
+     * Converts the statistics to a JSON Object
+     *
+     * \return  JSON Object
+     */
+    QJsonObject toJson() const;
+};
+
+} // namespace CppConfigFramework
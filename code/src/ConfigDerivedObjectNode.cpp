@@ -73,6 +73,7 @@ QList<ConfigNodePath> ConfigDerivedObjectNode::bases() const
 void ConfigDerivedObjectNode::setBases(const QList<ConfigNodePath> &bases)
 {
     m_bases = bases;
+    invalidateParentSharedMembers();
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -87,6 +88,7 @@ const ConfigObjectNode &ConfigDerivedObjectNode::config() const
 void ConfigDerivedObjectNode::setConfig(const ConfigObjectNode &config)
 {
     m_config = std::move(config.clone()->toObject());
+    invalidateParentSharedMembers();
 }
 
 } // namespace CppConfigFramework
@@ -0,0 +1,262 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a cache for the included configuration files
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigIncludeCache.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+
+// Qt includes
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+void ConfigIncludeCache::Dependencies::merge(const Dependencies &other)
+{
+    files.insert(files.end(), other.files.begin(), other.files.end());
+    externalNodeLookups.insert(externalNodeLookups.end(),
+                               other.externalNodeLookups.begin(),
+                               other.externalNodeLookups.end());
+    cacheable = (cacheable && other.cacheable);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigIncludeCache::count() const
+{
+    QMutexLocker locker(&m_mutex);
+    int entryCount = 0;
+
+    for (const auto &item : m_entries)
+    {
+        entryCount += static_cast<int>(item.second.size());
+    }
+
+    return entryCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigIncludeCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigIncludeCache::find(
+        const QString &filePath,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables,
+        Dependencies *dependencies)
+{
+    Q_ASSERT(environmentVariables != nullptr);
+    Q_ASSERT(dependencies != nullptr);
+
+    std::shared_ptr<const Entry> foundEntry;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        auto it = m_entries.find(createKey(filePath, sourceNodePath, destinationNodePath));
+
+        if (it == m_entries.end())
+        {
+            return {};
+        }
+
+        auto &entries = it->second;
+
+        for (auto entryIt = entries.begin(); entryIt != entries.end(); )
+        {
+            const auto &entry = *entryIt;
+
+            // Remove the outdated entries
+            if (!areFilesUnchanged(entry->dependencies.files))
+            {
+                entryIt = entries.erase(entryIt);
+                continue;
+            }
+
+            // Check the environment variables
+            const bool environmentMatches =
+                    std::all_of(entry->requiredEnvironmentVariables.begin(),
+                                entry->requiredEnvironmentVariables.end(),
+                                [environmentVariables](const EnvironmentVariableValue &variable)
+                                {
+                                    if (!environmentVariables->contains(variable.name))
+                                    {
+                                        return !variable.isSet;
+                                    }
+
+                                    return (variable.isSet &&
+                                            (environmentVariables->value(variable.name) ==
+                                             variable.value));
+                                });
+
+            if (environmentMatches &&
+                areExternalNodesMissing(entry->dependencies.externalNodeLookups, externalConfigs))
+            {
+                foundEntry = entry;
+                break;
+            }
+
+            entryIt++;
+        }
+
+        if (entries.empty())
+        {
+            m_entries.erase(it);
+        }
+    }
+
+    if (!foundEntry)
+    {
+        return {};
+    }
+
+    // Apply the changes to the environment variables
+    for (const auto &change : foundEntry->environmentVariableChanges)
+    {
+        environmentVariables->setValue(change.first, change.second);
+    }
+
+    dependencies->merge(foundEntry->dependencies);
+
+    auto config = foundEntry->config->clone();
+    return std::unique_ptr<ConfigObjectNode>(static_cast<ConfigObjectNode *>(config.release()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigIncludeCache::insert(const QString &filePath,
+                                const ConfigNodePath &sourceNodePath,
+                                const ConfigNodePath &destinationNodePath,
+                                const std::vector<const ConfigObjectNode *> &externalConfigs,
+                                const EnvironmentVariables &initialEnvironmentVariables,
+                                const EnvironmentVariables &finalEnvironmentVariables,
+                                const EnvironmentVariables::AccessRecord &accessRecord,
+                                const Dependencies &dependencies,
+                                const ConfigObjectNode &config)
+{
+    // Configurations that depend on the external configuration nodes cannot be cached
+    if ((!dependencies.cacheable) ||
+        (!areExternalNodesMissing(dependencies.externalNodeLookups, externalConfigs)))
+    {
+        return false;
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->dependencies = dependencies;
+
+    for (const QString &name : accessRecord.readNames)
+    {
+        EnvironmentVariableValue variable;
+        variable.name = name;
+        variable.isSet = initialEnvironmentVariables.contains(name);
+
+        if (variable.isSet)
+        {
+            variable.value = initialEnvironmentVariables.value(name);
+        }
+
+        entry->requiredEnvironmentVariables.push_back(variable);
+    }
+
+    for (const QString &name : accessRecord.writtenNames)
+    {
+        entry->environmentVariableChanges.emplace_back(name, finalEnvironmentVariables.value(name));
+    }
+
+    // The cached configuration must not keep the memory of the read procedure's arena alive, so it
+    // is a deep copy allocated on the heap (a clone would share the nodes of the read procedure).
+    // Cloning it once creates the shared members of its whole subtree, so the clones made by find()
+    // (possibly from multiple threads) do not add any nodes to the cached configuration.
+    ConfigNodeArena::HeapScope heapScope;
+    entry->config = config.deepClone();
+    entry->config->clone();
+
+    QMutexLocker locker(&m_mutex);
+    m_entries[createKey(filePath, sourceNodePath, destinationNodePath)].push_back(entry);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigIncludeCache::createKey(const QString &filePath,
+                                      const ConfigNodePath &sourceNodePath,
+                                      const ConfigNodePath &destinationNodePath)
+{
+    return QString("%1\n%2\n%3").arg(filePath, sourceNodePath.path(), destinationNodePath.path());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigIncludeCache::areFilesUnchanged(const std::vector<FileInfo> &files)
+{
+    for (const auto &file : files)
+    {
+        const QFileInfo fileInfo(file.filePath);
+
+        if ((!fileInfo.exists()) ||
+            (fileInfo.size() != file.size) ||
+            (fileInfo.lastModified() != file.lastModified))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigIncludeCache::areExternalNodesMissing(
+        const std::vector<ConfigReaderBase::ExternalNodeLookup> &externalNodeLookups,
+        const std::vector<const ConfigObjectNode *> &externalConfigs)
+{
+    for (const auto &lookup : externalNodeLookups)
+    {
+        if (ConfigReaderBase::findExternalConfigNode(lookup.referenceNodePath,
+                                                     lookup.parentNodePath,
+                                                     externalConfigs) != nullptr)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace CppConfigFramework
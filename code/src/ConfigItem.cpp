@@ -23,6 +23,7 @@
 #include <CppConfigFramework/ConfigItem.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigTracer.hpp>
 
 // Qt includes
 #include <QtCore/QJsonArray>
@@ -40,8 +41,91 @@
 namespace CppConfigFramework
 {
 
+ConfigItem::ParameterName::ParameterName(const QString &name)
+    : m_string(&name)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigItem::ParameterName::ParameterName(QLatin1String name)
+    : m_string(nullptr),
+      m_latin1String(name)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigItem::ParameterName::ParameterName(const char *name)
+    : m_string(nullptr),
+      m_latin1String(name)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigItem::ParameterName::isValid() const
+{
+    if (m_string != nullptr)
+    {
+        return ConfigNodePath::validateNodeName(*m_string);
+    }
+
+    return ConfigNodePath::validateNodeName(m_latin1String);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNode *ConfigItem::ParameterName::member(const ConfigObjectNode &config) const
+{
+    if (m_string != nullptr)
+    {
+        return config.member(*m_string);
+    }
+
+    return config.member(m_latin1String);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigItem::ParameterName::setMember(ConfigObjectNode *config,
+                                          std::unique_ptr<ConfigNode> node) const
+{
+    Q_ASSERT(config != nullptr);
+
+    if (m_string != nullptr)
+    {
+        return config->setMember(*m_string, std::move(node));
+    }
+
+    return config->setMember(m_latin1String, std::move(node));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigItem::ParameterName::toString() const
+{
+    if (m_string != nullptr)
+    {
+        return *m_string;
+    }
+
+    return QString(m_latin1String);
+}
+
+// -------------------------------------------------------------------------------------------------
+
 bool ConfigItem::loadConfig(const ConfigObjectNode &config)
 {
+    ConfigTraceSpan traceSpan(QStringLiteral("item"), QStringLiteral("Load config"));
+
+    if (traceSpan.isActive())
+    {
+        const QString nodePath = config.nodePath().path();
+        traceSpan.setName(QStringLiteral("Load config: ") + nodePath);
+        traceSpan.setArgument(QStringLiteral("node_path"), nodePath);
+    }
+
     if (!loadConfigParameters(config))
     {
         const QString errorString = QString("Failed to load the configuration parameters [%1]!")
@@ -268,7 +352,7 @@ bool ConfigItem::storeConfigAtPath(const ConfigNodePath &path, ConfigObjectNode
     }
 
     // Get or create the object node at path (create missing nodes as object nodes)
-    const auto nodeNameList = path.nodeNames();
+    const auto &nodeNameList = path.nodeNames();
     ConfigNode *node = path.isAbsolute() ? config->rootNode()
                                          : config;
 
@@ -0,0 +1,96 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a table of interned member names
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNameTable.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QMutexLocker>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+int ConfigNameTable::count() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_names.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigNameTable::intern(const QString &name)
+{
+    QMutexLocker locker(&m_mutex);
+    auto it = m_names.constFind(name);
+
+    if (it != m_names.constEnd())
+    {
+        return *it;
+    }
+
+    // Store a copy without any unused capacity since it is kept for the lifetime of the table
+    QString internedName(name.constData(), name.size());
+    m_names.insert(internedName);
+    return internedName;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigNameTable::removeUnused()
+{
+    QMutexLocker locker(&m_mutex);
+    int removedCount = 0;
+
+    for (auto it = m_names.begin(); it != m_names.end(); )
+    {
+        // A name which is not shared is referenced only by the table
+        if (it->isDetached())
+        {
+            it = m_names.erase(it);
+            removedCount++;
+        }
+        else
+        {
+            it++;
+        }
+    }
+
+    return removedCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNameTable::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_names.clear();
+}
+
+} // namespace CppConfigFramework
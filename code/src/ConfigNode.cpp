@@ -23,6 +23,7 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
@@ -30,6 +31,7 @@
 // Qt includes
 
 // System includes
+#include <algorithm>
 
 // Forward declarations
 
@@ -47,6 +49,20 @@ ConfigNode::ConfigNode(ConfigObjectNode *parent)
 
 // -------------------------------------------------------------------------------------------------
 
+void *ConfigNode::operator new(std::size_t size)
+{
+    return ConfigNodeArena::allocate(size);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::operator delete(void *memory)
+{
+    ConfigNodeArena::deallocate(memory);
+}
+
+// -------------------------------------------------------------------------------------------------
+
 bool ConfigNode::isValue() const
 {
     return (type() == Type::Value);
@@ -103,6 +119,23 @@ void ConfigNode::setParent(ConfigObjectNode *parent)
 
 // -------------------------------------------------------------------------------------------------
 
+void ConfigNode::invalidateParentSharedMembers()
+{
+    if (m_parent != nullptr)
+    {
+        m_parent->invalidateSharedMembers();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigNode::nodeName() const
+{
+    return m_name;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 const ConfigObjectNode *ConfigNode::rootNode() const
 {
     // Check if this is the root node
@@ -219,12 +252,18 @@ ConfigNodePath ConfigNode::nodePath() const
         return ConfigNodePath::ROOT_PATH;
     }
 
-    // Get the base path
-    auto basePath = parent()->isRoot() ? ConfigNodePath::ROOT_PATH
-                                       : parent()->nodePath();
+    // Collect the names of all nodes up to the root node and join them to a path
+    QStringList nodeNames;
+
+    for (const ConfigNode *node = this; !node->isRoot(); node = node->parent())
+    {
+        nodeNames.append(node->m_name);
+    }
+
+    std::reverse(nodeNames.begin(), nodeNames.end());
 
-    // Append the name of this node to the path
-    return basePath.append(parent()->name(*this));
+    return ConfigNodePath(ConfigNodePath::ROOT_PATH_VALUE +
+                          nodeNames.join(ConfigNodePath::ROOT_PATH_VALUE));
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -260,7 +299,7 @@ const ConfigNode *ConfigNode::nodeAtPath(const ConfigNodePath &nodePath) const
         currentNode = this;
     }
 
-    const auto nodeNameList = nodePath.nodeNames();
+    const auto &nodeNameList = nodePath.nodeNames();
 
     for (const QString &nodeName : nodeNameList)
     {
@@ -0,0 +1,346 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains an arena for the memory of configuration nodes
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QReadWriteLock>
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <new>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Alignment of the node allocations from an arena
+static constexpr std::size_t NODE_ALIGNMENT = 8U;
+
+static_assert(alignof(ConfigDerivedObjectNode) <= NODE_ALIGNMENT, "Unsupported node alignment");
+static_assert(alignof(ConfigNodeReference) <= NODE_ALIGNMENT, "Unsupported node alignment");
+static_assert(alignof(ConfigObjectNode) <= NODE_ALIGNMENT, "Unsupported node alignment");
+static_assert(alignof(ConfigValueNode) <= NODE_ALIGNMENT, "Unsupported node alignment");
+
+/*!
+ * Number of references that an arena reserves in its storage at once (the references are reserved
+ * in batches so that allocation of a node does not need an atomic operation)
+ */
+static constexpr int REFERENCE_BATCH_SIZE = 1024;
+
+//! Holds the arena which is active on the current thread
+static thread_local ConfigNodeArena *s_activeArena = nullptr;
+
+//! Holds the number of arena storages which were not freed yet
+static std::atomic<int> s_storageCount { 0 };
+
+// -------------------------------------------------------------------------------------------------
+
+const int ConfigNodeArena::DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+// -------------------------------------------------------------------------------------------------
+
+struct ConfigNodeArena::Storage
+{
+    //! Holds the address range of a memory block
+    struct Block
+    {
+        //! End of the memory block
+        const char *end;
+
+        //! Storage that holds the memory block
+        Storage *storage;
+    };
+
+    /*!
+     * Number of references to the storage (the arena holds one reference and each of the nodes
+     * allocated from it holds one reference)
+     */
+    std::atomic<int> referenceCount { 1 };
+
+    //! Number of references reserved by the arena for its nodes (used only by the arena's thread)
+    int reservedReferences = 0;
+
+    //! Number of nodes allocated from the storage (used only by the arena's thread)
+    int nodeCount = 0;
+
+    //! Size of the memory blocks
+    std::size_t blockSize = 0U;
+
+    //! Allocated memory blocks
+    std::vector<char *> blocks;
+
+    //! Free memory in the last memory block
+    char *position = nullptr;
+
+    //! Number of bytes left in the last memory block
+    std::size_t remainingSize = 0U;
+
+    //! Number of bytes allocated for the nodes
+    qint64 allocatedSize = 0;
+
+    //! Memory blocks of all storages in the process (ordered by their start address)
+    static std::map<const char *, Block, std::less<const char *>> s_allBlocks;
+
+    //! Protects the memory blocks of all storages
+    static QReadWriteLock s_allBlocksLock;
+
+    /*!
+     * Allocates a new memory block
+     *
+     * \param   size    Size of the memory block (in bytes)
+     *
+     * \return  Memory block
+     */
+    char *allocateBlock(const std::size_t size)
+    {
+        char *block = static_cast<char *>(::operator new(size));
+        blocks.push_back(block);
+
+        QWriteLocker locker(&s_allBlocksLock);
+        s_allBlocks.emplace(block, Block { block + size, this });
+        return block;
+    }
+
+    /*!
+     * Releases references to the storage and frees the memory blocks when the last reference is
+     * released
+     *
+     * \param   count   Number of references to release
+     */
+    void release(const int count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (referenceCount.fetch_sub(count, std::memory_order_acq_rel) == count)
+        {
+            {
+                QWriteLocker locker(&s_allBlocksLock);
+
+                for (char *block : blocks)
+                {
+                    s_allBlocks.erase(block);
+                }
+            }
+
+            for (char *block : blocks)
+            {
+                ::operator delete(block);
+            }
+
+            s_storageCount.fetch_sub(1, std::memory_order_relaxed);
+            delete this;
+        }
+    }
+
+    /*!
+     * Finds the storage that the memory was allocated from
+     *
+     * \param   memory  Memory of a node
+     *
+     * \return  Storage or null if the memory was not allocated from a storage
+     */
+    static Storage *find(const void *memory)
+    {
+        const char *address = static_cast<const char *>(memory);
+        const std::less<const char *> isLess;
+
+        QReadLocker locker(&s_allBlocksLock);
+        auto it = s_allBlocks.upper_bound(address);
+
+        if (it == s_allBlocks.begin())
+        {
+            return nullptr;
+        }
+
+        --it;
+        return isLess(address, it->second.end) ? it->second.storage : nullptr;
+    }
+};
+
+std::map<const char *, ConfigNodeArena::Storage::Block, std::less<const char *>>
+ConfigNodeArena::Storage::s_allBlocks;
+
+QReadWriteLock ConfigNodeArena::Storage::s_allBlocksLock;
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::HeapScope::HeapScope()
+    : m_previousArena(s_activeArena)
+{
+    s_activeArena = nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::HeapScope::~HeapScope()
+{
+    s_activeArena = m_previousArena;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::ConfigNodeArena(const int blockSize)
+    : m_storage(new Storage),
+      m_previousArena(s_activeArena)
+{
+    Q_ASSERT(blockSize > 0);
+
+    m_storage->blockSize = static_cast<std::size_t>(blockSize);
+    s_storageCount.fetch_add(1, std::memory_order_relaxed);
+    s_activeArena = this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::~ConfigNodeArena()
+{
+    Q_ASSERT(s_activeArena == this);
+
+    s_activeArena = m_previousArena;
+
+    // Release the arena's own reference and the references that were reserved but not used
+    m_storage->release(1 + m_storage->reservedReferences - m_storage->nodeCount);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigNodeArena::blockCount() const
+{
+    return static_cast<int>(m_storage->blocks.size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigNodeArena::allocatedSize() const
+{
+    return m_storage->allocatedSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena *ConfigNodeArena::active()
+{
+    return s_activeArena;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigNodeArena::storageCount()
+{
+    return s_storageCount.load(std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void *ConfigNodeArena::allocate(const std::size_t size)
+{
+    if (s_activeArena == nullptr)
+    {
+        return ::operator new(size);
+    }
+
+    Storage *storage = s_activeArena->m_storage;
+    const std::size_t allocationSize =
+            ((size + NODE_ALIGNMENT - 1U) / NODE_ALIGNMENT) * NODE_ALIGNMENT;
+    char *memory = nullptr;
+
+    if (allocationSize > storage->remainingSize)
+    {
+        // Oversized nodes get their own memory block so that the current block can still be used
+        // for the following nodes
+        const std::size_t blockSize = std::max(storage->blockSize, allocationSize);
+        char *block = storage->allocateBlock(blockSize);
+
+        if (blockSize == allocationSize)
+        {
+            memory = block;
+        }
+        else
+        {
+            storage->position = block;
+            storage->remainingSize = blockSize;
+        }
+    }
+
+    if (memory == nullptr)
+    {
+        memory = storage->position;
+        storage->position += allocationSize;
+        storage->remainingSize -= allocationSize;
+    }
+
+    storage->allocatedSize += static_cast<qint64>(allocationSize);
+
+    if (storage->nodeCount == storage->reservedReferences)
+    {
+        storage->referenceCount.fetch_add(REFERENCE_BATCH_SIZE, std::memory_order_relaxed);
+        storage->reservedReferences += REFERENCE_BATCH_SIZE;
+    }
+
+    storage->nodeCount++;
+    return memory;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeArena::deallocate(void *memory)
+{
+    if (memory == nullptr)
+    {
+        return;
+    }
+
+    // The memory can belong to an arena only while there are arena storages, otherwise the lookup
+    // of the memory block is skipped
+    if (s_storageCount.load(std::memory_order_acquire) > 0)
+    {
+        Storage *storage = Storage::find(memory);
+
+        if (storage != nullptr)
+        {
+            storage->release(1);
+            return;
+        }
+    }
+
+    ::operator delete(memory);
+}
+
+} // namespace CppConfigFramework
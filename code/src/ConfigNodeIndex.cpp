@@ -0,0 +1,150 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains an index of configuration nodes by their node paths
+ */
+
+
+// Own header
+#include <CppConfigFramework/ConfigNodeIndex.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+ConfigNodeIndex::ConfigNodeIndex(const ConfigObjectNode &config)
+    : m_config(&config)
+{
+    m_nodes.insert(ConfigNodePath::ROOT_PATH_VALUE, m_config);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigObjectNode &ConfigNodeIndex::config() const
+{
+    return *m_config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigNodeIndex::count() const
+{
+    return m_nodes.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNode *ConfigNodeIndex::find(const ConfigNodePath &nodePath)
+{
+    if ((!nodePath.isValid()) || (!nodePath.isAbsolute()))
+    {
+        return nullptr;
+    }
+
+    // A node path that was already looked up is found with a single hash lookup
+    const QString path = nodePath.path();
+    auto pathIt = m_nodes.constFind(path);
+
+    if (pathIt != m_nodes.constEnd())
+    {
+        return pathIt.value();
+    }
+
+    // Otherwise walk the node names like ConfigNode::nodeAtPath() does, so that each node on the
+    // node path (also the ones before a parent node reference) must exist. The visited nodes are
+    // stored in the index under their canonical node paths (so that the walks of other node paths
+    // can reuse them) and the result is also stored under the node path itself.
+    QStringList keys;
+    keys.reserve(nodePath.nodeNames().size() + 1);
+    keys.append(ConfigNodePath::ROOT_PATH_VALUE);
+
+    const ConfigNode *node = m_config;
+
+    for (const QString &nodeName : nodePath.nodeNames())
+    {
+        if (nodeName == ConfigNodePath::PARENT_PATH_VALUE)
+        {
+            if (keys.size() == 1)
+            {
+                // Parent of the root node
+                node = nullptr;
+                break;
+            }
+
+            keys.removeLast();
+            node = m_nodes.value(keys.last());
+            Q_ASSERT(node != nullptr);
+            continue;
+        }
+
+        const QString key = (keys.size() == 1) ? (keys.last() + nodeName)
+                                               : (keys.last() + QLatin1Char('/') + nodeName);
+        auto it = m_nodes.constFind(key);
+
+        if (it != m_nodes.constEnd())
+        {
+            node = it.value();
+        }
+        else
+        {
+            node = node->isObject() ? node->toObject().member(nodeName) : nullptr;
+            m_nodes.insert(key, node);
+        }
+
+        if (node == nullptr)
+        {
+            break;
+        }
+
+        keys.append(key);
+    }
+
+    m_nodes.insert(path, node);
+    return node;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNode *ConfigNodeIndex::find(const ConfigNodePath &referenceNodePath,
+                                        const ConfigNodePath &parentNodePath)
+{
+    if (referenceNodePath.isAbsolute())
+    {
+        return find(referenceNodePath);
+    }
+
+    // The equivalent of the parent node must exist in the indexed tree
+    if (find(parentNodePath) == nullptr)
+    {
+        return nullptr;
+    }
+
+    return find(referenceNodePath.toAbsolute(parentNodePath));
+}
+
+} // namespace CppConfigFramework
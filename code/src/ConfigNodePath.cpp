@@ -25,10 +25,11 @@
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
-#include <QtCore/QRegularExpression>
 #include <QtCore/QStringBuilder>
 
 // System includes
+#include <memory>
+#include <cstdint>
 
 // Forward declarations
 
@@ -48,127 +49,183 @@ const ConfigNodePath ConfigNodePath::PARENT_PATH = ConfigNodePath(ConfigNodePath
 
 static const QChar NODE_PATH_SEPARATOR = QChar('/');
 
-// -------------------------------------------------------------------------------------------------
+//! Node name character class of characters allowed at the start of a node name
+static constexpr uint8_t NODE_NAME_FIRST_CHARACTER = 0x01U;
 
-ConfigNodePath::ConfigNodePath(const QString &path)
-    : m_path(path)
+//! Node name character class of characters allowed in the rest of the node name
+static constexpr uint8_t NODE_NAME_OTHER_CHARACTER = 0x02U;
+
+//! Lookup table with node name character classes for all ASCII characters
+struct NodeNameCharacterTable
 {
-}
+    //! Constructor
+    constexpr NodeNameCharacterTable()
+        : characterClasses()
+    {
+        for (int c = 'a'; c <= 'z'; c++)
+        {
+            characterClasses[c] = NODE_NAME_FIRST_CHARACTER | NODE_NAME_OTHER_CHARACTER;
+        }
+
+        for (int c = 'A'; c <= 'Z'; c++)
+        {
+            characterClasses[c] = NODE_NAME_FIRST_CHARACTER | NODE_NAME_OTHER_CHARACTER;
+        }
+
+        for (int c = '0'; c <= '9'; c++)
+        {
+            characterClasses[c] = NODE_NAME_OTHER_CHARACTER;
+        }
+
+        characterClasses['_'] = NODE_NAME_OTHER_CHARACTER;
+    }
+
+    //! Character classes indexed by the character code
+    uint8_t characterClasses[128];
+};
+
+//! Lookup table for node name validation (constant initialized so it can be used at any time)
+static constexpr NodeNameCharacterTable NODE_NAME_CHARACTER_TABLE;
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigNodePath::isRoot() const
+/*!
+ * Gets the code of a character
+ *
+ * \param   character   Character
+ *
+ * \return  Character code
+ */
+static inline uint32_t characterCode(const QChar character)
 {
-    return (m_path == ROOT_PATH_VALUE);
+    return character.unicode();
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigNodePath::isAbsolute() const
+//! \copydoc    characterCode()
+static inline uint32_t characterCode(const char character)
 {
-    return m_path.startsWith(NODE_PATH_SEPARATOR);
+    return static_cast<unsigned char>(character);
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigNodePath::isRelative() const
+/*!
+ * Checks if the characters form a valid node name (equivalent to the regular expression
+ * "^[a-zA-Z][a-zA-Z0-9_]*$")
+ *
+ * \param   name    Pointer to the first character of the node name
+ * \param   size    Number of characters in the node name
+ *
+ * \retval  true    Valid node name
+ * \retval  false   Invalid node name
+ */
+template<typename T>
+static bool validateNodeNameCharacters(const T *name, const int size)
 {
-    // Check for an empty
-    if (m_path.isEmpty())
+    if ((name == nullptr) || (size <= 0))
     {
-        // Error, an empty path is not a relative path
         return false;
     }
 
-    return (!isAbsolute());
-}
-
-// -------------------------------------------------------------------------------------------------
+    // Check the first character
+    uint32_t code = characterCode(name[0]);
 
-bool ConfigNodePath::isValid() const
-{
-    // Check for an empty
-    if (m_path.isEmpty())
+    if ((code >= 128U) ||
+        ((NODE_NAME_CHARACTER_TABLE.characterClasses[code] & NODE_NAME_FIRST_CHARACTER) == 0U))
     {
-        // Error, an empty path is not valid
         return false;
     }
 
-    // Check for "root" path
-    if (isRoot())
+    // Check the rest of the characters
+    for (int i = 1; i < size; i++)
     {
-        return true;
+        code = characterCode(name[i]);
+
+        if ((code >= 128U) ||
+            ((NODE_NAME_CHARACTER_TABLE.characterClasses[code] & NODE_NAME_OTHER_CHARACTER) == 0U))
+        {
+            return false;
+        }
     }
 
-    // Use different algorithms for absolute and relative path validation
-    const auto nodeNameList = nodeNames();
+    return true;
+}
 
-    if (isAbsolute())
-    {
-        // Make sure that the individual node names are valid and that there is no attempt to access
-        // the parent node of the root node
-        unsigned int depth = 0;
+// -------------------------------------------------------------------------------------------------
 
-        for (const QString &nodeName : nodeNameList)
-        {
-            if (nodeName == PARENT_PATH_VALUE)
-            {
-                if (depth == 0)
-                {
-                    // Error, the root node does not have a parent node
-                    return false;
-                }
+ConfigNodePath::ConfigNodePath(const QString &path)
+    : m_path(path)
+{
+    updateProperties();
+}
 
-                depth--;
-                continue;
-            }
+// -------------------------------------------------------------------------------------------------
 
-            if (!validateNodeName(nodeName))
-            {
-                // Error, invalid node name
-                return false;
-            }
+ConfigNodePath::ConfigNodePath(const ConfigNodePath &other)
+    : m_path(other.m_path),
+      m_nodeNames(std::atomic_load(&other.m_nodeNames)),
+      m_valid(other.m_valid),
+      m_hasUnresolvedReferences(other.m_hasUnresolvedReferences)
+{
+}
 
-            depth++;
-        }
-    }
-    else
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodePath &ConfigNodePath::operator=(const ConfigNodePath &other)
+{
+    if (this != &other)
     {
-        // Make sure that just the individual node names are valid
-        for (const QString &nodeName : nodeNameList)
-        {
-            if ((nodeName != PARENT_PATH_VALUE) && (!validateNodeName(nodeName)))
-            {
-                return false;
-            }
-        }
+        m_path = other.m_path;
+        m_nodeNames = std::atomic_load(&other.m_nodeNames);
+        m_valid = other.m_valid;
+        m_hasUnresolvedReferences = other.m_hasUnresolvedReferences;
     }
 
-    return true;
+    return *this;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigNodePath::hasUnresolvedReferences() const
+bool ConfigNodePath::isRoot() const
+{
+    return (m_path == ROOT_PATH_VALUE);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodePath::isAbsolute() const
+{
+    return m_path.startsWith(NODE_PATH_SEPARATOR);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodePath::isRelative() const
 {
     // Check for an empty
     if (m_path.isEmpty())
     {
-        // Error, an empty path is not valid
+        // Error, an empty path is not a relative path
         return false;
     }
 
-    // Check for "root" path
-    if (isRoot())
-    {
-        return false;
-    }
+    return (!isAbsolute());
+}
 
-    // Check if ".." is the only node, the first node, middle node or the last node
-    static const QRegularExpression s_regex(QStringLiteral("(?>^|\\/)\\.\\.(?>\\/|$)"));
+// -------------------------------------------------------------------------------------------------
 
-    auto match = s_regex.match(m_path);
-    return match.hasMatch();
+bool ConfigNodePath::isValid() const
+{
+    return m_valid;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodePath::hasUnresolvedReferences() const
+{
+    return m_hasUnresolvedReferences;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -216,11 +273,11 @@ bool ConfigNodePath::resolveReferences()
 
         if (workingNodeNames.isEmpty())
         {
-            m_path = ROOT_PATH_VALUE;
+            setPath(ROOT_PATH_VALUE);
         }
         else
         {
-            m_path = NODE_PATH_SEPARATOR % workingNodeNames.join(NODE_PATH_SEPARATOR);
+            setPath(NODE_PATH_SEPARATOR % workingNodeNames.join(NODE_PATH_SEPARATOR));
         }
     }
     else
@@ -255,7 +312,7 @@ bool ConfigNodePath::resolveReferences()
             return false;
         }
 
-        m_path = workingNodeNames.join(NODE_PATH_SEPARATOR);
+        setPath(workingNodeNames.join(NODE_PATH_SEPARATOR));
     }
 
     return true;
@@ -273,14 +330,39 @@ QString ConfigNodePath::path() const
 void ConfigNodePath::setPath(const QString &path)
 {
     m_path = path;
+    m_nodeNames.reset();
+    updateProperties();
 }
 
 // -------------------------------------------------------------------------------------------------
 
-QStringList ConfigNodePath::nodeNames() const
+const QStringList &ConfigNodePath::nodeNames() const
 {
-    return (isAbsolute() ? m_path.mid(1).split(NODE_PATH_SEPARATOR)
-                         : m_path.split(NODE_PATH_SEPARATOR));
+    // Empty and root node paths do not have any node names (string literals are used instead of
+    // the static constants since a node path can also be used during static initialization)
+    if (m_path.isEmpty() || (m_path == QLatin1String("/")))
+    {
+        static const QStringList s_emptyNodeNames;
+        return s_emptyNodeNames;
+    }
+
+    // Split the node path on first use (if multiple threads do it at the same time only the node
+    // names of the first one are kept)
+    auto nodeNameList = std::atomic_load(&m_nodeNames);
+
+    if (!nodeNameList)
+    {
+        auto splitNodeNames = std::make_shared<const QStringList>(
+                    isAbsolute() ? m_path.mid(1).split(NODE_PATH_SEPARATOR)
+                                 : m_path.split(NODE_PATH_SEPARATOR));
+
+        if (std::atomic_compare_exchange_strong(&m_nodeNames, &nodeNameList, splitNodeNames))
+        {
+            nodeNameList = splitNodeNames;
+        }
+    }
+
+    return *nodeNameList;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -327,11 +409,12 @@ ConfigNodePath &ConfigNodePath::append(const QString &nodeName)
     if ((!isValid()) || (!validateNodeName(nodeName)))
     {
         // Error, invalidate this path and return it
-        m_path.clear();
+        setPath(QString());
         return *this;
     }
 
-    // Append the specified node path to this path
+    // Append the specified node path to this path (a valid node name doesn't change the properties
+    // of a valid path)
     if (isRoot())
     {
         m_path.append(nodeName);
@@ -341,6 +424,7 @@ ConfigNodePath &ConfigNodePath::append(const QString &nodeName)
         m_path.append(NODE_PATH_SEPARATOR % nodeName);
     }
 
+    m_nodeNames.reset();
     return *this;
 }
 
@@ -359,7 +443,7 @@ ConfigNodePath &ConfigNodePath::append(const ConfigNodePath &nodePath)
     if ((!isValid()) || nodePath.isAbsolute() || (!nodePath.isValid()))
     {
         // Error, invalidate this path and return it
-        m_path.clear();
+        setPath(QString());
         return *this;
     }
 
@@ -373,6 +457,8 @@ ConfigNodePath &ConfigNodePath::append(const ConfigNodePath &nodePath)
         m_path.append(NODE_PATH_SEPARATOR % nodePath.path());
     }
 
+    m_nodeNames.reset();
+    updateProperties();
     return *this;
 }
 
@@ -380,12 +466,113 @@ ConfigNodePath &ConfigNodePath::append(const ConfigNodePath &nodePath)
 
 bool ConfigNodePath::validateNodeName(const QString &name)
 {
-    // Check if the name starts with a letter and continues with an optional string of alphanumeric
-    // and "_" characters
-    static const QRegularExpression s_regex(QStringLiteral("^[a-zA-Z][a-zA-Z0-9_]*$"));
+    return validateNodeName(name.constData(), name.size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodePath::validateNodeName(const QChar *name, const int size)
+{
+    return validateNodeNameCharacters(name, size);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodePath::validateNodeName(QLatin1String name)
+{
+    return validateNodeNameCharacters(name.data(), name.size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodePath::validateNodeNames(const QStringList &names)
+{
+    for (const QString &name : names)
+    {
+        if (!validateNodeNameCharacters(name.constData(), name.size()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodePath::updateProperties()
+{
+    m_valid = false;
+    m_hasUnresolvedReferences = false;
+
+    // Check for an empty path (not valid)
+    if (m_path.isEmpty())
+    {
+        return;
+    }
+
+    // Check for "root" path (string literals are used instead of the static constants since a
+    // node path can also be created during static initialization)
+    if (m_path == QLatin1String("/"))
+    {
+        m_valid = true;
+        return;
+    }
+
+    // Check the individual node names in place. For an absolute node path also make sure that there
+    // is no attempt to access the parent node of the root node.
+    const bool absolute = isAbsolute();
+    const QChar *data = m_path.constData();
+    const int size = m_path.size();
+
+    bool valid = true;
+    unsigned int depth = 0;
+    int nodeNameStart = (absolute ? 1 : 0);
+
+    while (nodeNameStart <= size)
+    {
+        int nodeNameEnd = m_path.indexOf(NODE_PATH_SEPARATOR, nodeNameStart);
+
+        if (nodeNameEnd < 0)
+        {
+            nodeNameEnd = size;
+        }
+
+        const QChar *nodeName = data + nodeNameStart;
+        const int nodeNameSize = nodeNameEnd - nodeNameStart;
+
+        if ((nodeNameSize == 2) && (nodeName[0] == QChar('.')) && (nodeName[1] == QChar('.')))
+        {
+            m_hasUnresolvedReferences = true;
+
+            if (absolute)
+            {
+                if (depth == 0)
+                {
+                    // Error, the root node does not have a parent node
+                    valid = false;
+                }
+                else
+                {
+                    depth--;
+                }
+            }
+        }
+        else
+        {
+            if (!validateNodeNameCharacters(nodeName, nodeNameSize))
+            {
+                // Error, invalid node name
+                valid = false;
+            }
+
+            depth++;
+        }
+
+        nodeNameStart = nodeNameEnd + 1;
+    }
 
-    auto match = s_regex.match(name);
-    return match.hasMatch();
+    m_valid = valid;
 }
 
 } // namespace CppConfigFramework
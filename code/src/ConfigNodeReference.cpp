@@ -68,6 +68,7 @@ ConfigNodePath ConfigNodeReference::reference() const
 void ConfigNodeReference::setReference(const ConfigNodePath &reference)
 {
     m_reference = reference;
+    invalidateParentSharedMembers();
 }
 
 } // namespace CppConfigFramework
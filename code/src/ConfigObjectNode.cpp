@@ -31,6 +31,7 @@
 #include <QtCore/QStringBuilder>
 
 // System includes
+#include <algorithm>
 
 // Forward declarations
 
@@ -41,6 +42,123 @@
 namespace CppConfigFramework
 {
 
+/*!
+ * Checks if a member name is less than the specified name
+ *
+ * \param   memberName  Member name
+ * \param   name        Name to compare with
+ *
+ * \retval  true    Member name is less than the specified name
+ * \retval  false   Member name is not less than the specified name
+ */
+static bool isNameLess(const QString &memberName, const QString &name)
+{
+    return (memberName < name);
+}
+
+//! \copydoc    isNameLess()
+static bool isNameLess(const QString &memberName, QLatin1String name)
+{
+    return (memberName < name);
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+//! \copydoc    isNameLess()
+static bool isNameLess(const QString &memberName, QStringView name)
+{
+    return (QStringView(memberName).compare(name) < 0);
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if a member name is equal to the specified name
+ *
+ * \param   memberName  Member name
+ * \param   name        Name to compare with
+ *
+ * \retval  true    Names are equal
+ * \retval  false   Names are not equal
+ */
+static bool isNameEqual(const QString &memberName, const QString &name)
+{
+    return (memberName == name);
+}
+
+//! \copydoc    isNameEqual()
+static bool isNameEqual(const QString &memberName, QLatin1String name)
+{
+    return (memberName == name);
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+//! \copydoc    isNameEqual()
+static bool isNameEqual(const QString &memberName, QStringView name)
+{
+    return ((memberName.size() == name.size()) && (QStringView(memberName).compare(name) == 0));
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the name is a valid member name
+ *
+ * \param   name    Name
+ *
+ * \retval  true    Valid
+ * \retval  false   Invalid
+ */
+static bool isNameValid(const QString &name)
+{
+    return ConfigNodePath::validateNodeName(name);
+}
+
+//! \copydoc    isNameValid()
+static bool isNameValid(QLatin1String name)
+{
+    return ConfigNodePath::validateNodeName(name);
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+//! \copydoc    isNameValid()
+static bool isNameValid(QStringView name)
+{
+    return ConfigNodePath::validateNodeName(name.data(), static_cast<int>(name.size()));
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Converts the name to a string
+ *
+ * \param   name    Name
+ *
+ * \return  Name as a string
+ */
+static QString toNameString(const QString &name)
+{
+    return name;
+}
+
+//! \copydoc    toNameString()
+static QString toNameString(QLatin1String name)
+{
+    return QString(name);
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+//! \copydoc    toNameString()
+static QString toNameString(QStringView name)
+{
+    return name.toString();
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
 ConfigObjectNode::ConfigObjectNode(ConfigObjectNode *parent)
     : ConfigNode(parent)
 {
@@ -61,12 +179,21 @@ ConfigObjectNode::ConfigObjectNode(std::initializer_list<std::pair<QString, Conf
 
 ConfigObjectNode::ConfigObjectNode(ConfigObjectNode &&other) noexcept
     : ConfigNode(other.parent()),
-      m_members(std::move(other.m_members))
+      m_members(std::move(other.m_members)),
+      m_sharedMembers(other.m_sharedMembers),
+      m_layers(std::move(other.m_layers)),
+      m_unresolvedCount(other.m_unresolvedCount)
 {
     for (const auto &member : m_members)
     {
         member.second->setParent(this);
     }
+
+    // The other node (and its parents) no longer hold the moved members
+    other.m_members.clear();
+    other.m_layers.clear();
+    other.invalidateSharedMembers();
+    other.updateUnresolvedCount(-m_unresolvedCount);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -78,8 +205,24 @@ ConfigObjectNode &ConfigObjectNode::operator=(ConfigObjectNode &&other) noexcept
         return *this;
     }
 
+    // Neither this node's old members nor the other node's members remain where they were
+    m_layers.clear();
+    invalidateSharedMembers();
+    updateUnresolvedCount(-m_unresolvedCount);
+
+    const int otherUnresolvedCount = other.m_unresolvedCount;
+    auto otherSharedMembers = other.m_sharedMembers;
+    auto otherLayers = std::move(other.m_layers);
+    other.m_layers.clear();
+    other.invalidateSharedMembers();
+    other.updateUnresolvedCount(-otherUnresolvedCount);
+
     setParent(other.parent());
     m_members = std::move(other.m_members);
+    other.m_members.clear();
+    m_sharedMembers = std::move(otherSharedMembers);
+    m_layers = std::move(otherLayers);
+    m_unresolvedCount = otherUnresolvedCount;
 
     for (const auto &member : m_members)
     {
@@ -93,13 +236,11 @@ ConfigObjectNode &ConfigObjectNode::operator=(ConfigObjectNode &&other) noexcept
 
 std::unique_ptr<ConfigNode> ConfigObjectNode::clone() const
 {
+    // The clone just shares the members with this node until it is accessed
     auto clonedNode = std::make_unique<ConfigObjectNode>(nullptr);
-
-    for (const auto &member : m_members)
-    {
-        clonedNode->setMember(member.first, member.second->clone());
-    }
-
+    clonedNode->m_sharedMembers = sharedMembers();
+    clonedNode->m_layers.push_back(clonedNode->m_sharedMembers);
+    clonedNode->m_unresolvedCount = m_unresolvedCount;
     return clonedNode;
 }
 
@@ -114,23 +255,47 @@ ConfigNode::Type ConfigObjectNode::type() const
 
 int ConfigObjectNode::count() const
 {
-    return static_cast<int>(m_members.size());
+    return static_cast<int>(members().size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigObjectNode::unresolvedCount() const
+{
+    return m_unresolvedCount;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigObjectNode::contains(const QString &name) const
 {
-    return (m_members.find(name) != m_members.end());
+    return containsMember(name);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::contains(QLatin1String name) const
+{
+    return containsMember(name);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+bool ConfigObjectNode::contains(QStringView name) const
+{
+    return containsMember(name);
 }
+#endif
 
 // -------------------------------------------------------------------------------------------------
 
 QStringList ConfigObjectNode::names() const
 {
     QStringList nameList;
+    nameList.reserve(count());
 
-    for (auto &it : m_members)
+    for (auto &it : members())
     {
         nameList.append(it.first);
     }
@@ -142,22 +307,27 @@ QStringList ConfigObjectNode::names() const
 
 QString ConfigObjectNode::name(const ConfigNode &node) const
 {
-    for (auto &it : m_members)
+    // The node knows its own name, just make sure that it really is a member of this node
+    if (node.parent() != this)
     {
-        if (it.second.get() == &node)
-        {
-            return it.first;
-        }
+        return {};
     }
 
-    return {};
+    auto it = find(node.m_name);
+
+    if ((it == m_members.end()) || (it->second.get() != &node))
+    {
+        return {};
+    }
+
+    return it->first;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 const ConfigNode *ConfigObjectNode::member(const QString &name) const
 {
-    auto it = m_members.find(name);
+    auto it = find(name);
 
     if (it == m_members.end())
     {
@@ -171,7 +341,7 @@ const ConfigNode *ConfigObjectNode::member(const QString &name) const
 
 ConfigNode *ConfigObjectNode::member(const QString &name)
 {
-    auto it = m_members.find(name);
+    auto it = find(name);
 
     if (it == m_members.end())
     {
@@ -183,89 +353,212 @@ ConfigNode *ConfigObjectNode::member(const QString &name)
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigObjectNode::setMember(const QString &name, std::unique_ptr<ConfigNode> node)
+const ConfigNode *ConfigObjectNode::member(QLatin1String name) const
 {
-    // Make sure that name and node are both valid
-    if ((!ConfigNodePath::validateNodeName(name)) || (!node))
+    auto it = find(name);
+
+    if (it == m_members.end())
     {
-        return false;
+        return nullptr;
     }
 
-    // Set the parent to this node
-    node->setParent(this);
+    return it->second.get();
+}
+
+// -------------------------------------------------------------------------------------------------
 
-    // Insert or replace the member
-    auto it = m_members.find(name);
+ConfigNode *ConfigObjectNode::member(QLatin1String name)
+{
+    auto it = find(name);
 
     if (it == m_members.end())
     {
-        // Insert a new item
-        m_members.emplace(name, std::move(node));
+        return nullptr;
     }
-    else
+
+    return it->second.get();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+const ConfigNode *ConfigObjectNode::member(QStringView name) const
+{
+    auto it = find(name);
+
+    if (it == m_members.end())
     {
-        // Replace the existing item
-        it->second = std::move(node);
+        return nullptr;
     }
 
-    return true;
+    return it->second.get();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode *ConfigObjectNode::member(QStringView name)
+{
+    auto it = find(name);
+
+    if (it == m_members.end())
+    {
+        return nullptr;
+    }
+
+    return it->second.get();
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::setMember(const QString &name, std::unique_ptr<ConfigNode> node)
+{
+    return storeMember(name, std::move(node));
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigObjectNode::setMember(const QString &name, const ConfigNode &node)
 {
-    return setMember(name, node.clone());
+    return storeMember(name, node.clone());
 }
 
 // -------------------------------------------------------------------------------------------------
 
+bool ConfigObjectNode::setMember(QLatin1String name, std::unique_ptr<ConfigNode> node)
+{
+    return storeMember(name, std::move(node));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::setMember(QLatin1String name, const ConfigNode &node)
+{
+    return storeMember(name, node.clone());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+bool ConfigObjectNode::setMember(QStringView name, std::unique_ptr<ConfigNode> node)
+{
+    return storeMember(name, std::move(node));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::setMember(QStringView name, const ConfigNode &node)
+{
+    return storeMember(name, node.clone());
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
 bool ConfigObjectNode::remove(const QString &name)
 {
-    auto it = m_members.find(name);
+    auto it = find(name);
 
     if (it == m_members.end())
     {
         return false;
     }
 
+    invalidateSharedMembers();
+
+    const int unresolvedCountDelta = -unresolvedCount(*it->second);
     m_members.erase(it);
+
+    updateUnresolvedCount(unresolvedCountDelta);
     return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
+std::unique_ptr<ConfigNode> ConfigObjectNode::take(const QString &name)
+{
+    auto it = find(name);
+
+    if (it == m_members.end())
+    {
+        return {};
+    }
+
+    invalidateSharedMembers();
+
+    std::unique_ptr<ConfigNode> node = std::move(it->second);
+    m_members.erase(it);
+
+    updateUnresolvedCount(-unresolvedCount(*node));
+
+    node->setParent(nullptr);
+    node->m_name.clear();
+    return node;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 void ConfigObjectNode::removeAll()
 {
     m_members.clear();
+    m_layers.clear();
+    invalidateSharedMembers();
+    updateUnresolvedCount(-m_unresolvedCount);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 void ConfigObjectNode::apply(const ConfigObjectNode &other)
 {
-    // Merge nodes
-    for (const QString &name : other.names())
+    if (&other == this)
+    {
+        // Applying the node to itself would not change anything
+        return;
+    }
+
+    detach();
+    other.detach();
+    invalidateSharedMembers();
+
+    // Merge nodes (both member containers are sorted by name so each of the other node's members
+    // only needs to be searched for after the position of the previously applied member)
+    size_t position = 0U;
+
+    for (const auto &otherMember : other.m_members)
     {
-        const ConfigNode *memberOther = other.member(name);
+        const QString &name = otherMember.first;
+        const ConfigNode *memberOther = otherMember.second.get();
         Q_ASSERT(memberOther != nullptr);
 
         // Check if a member with the same name already exists
-        ConfigNode *memberThis = member(name);
+        auto it = std::lower_bound(m_members.begin() + static_cast<std::ptrdiff_t>(position),
+                                   m_members.end(),
+                                   name,
+                                   isMemberNameLess<QString>);
+        position = static_cast<size_t>(it - m_members.begin()) + 1U;
 
-        if (memberThis == nullptr)
+        if ((it == m_members.end()) || (it->first != name))
         {
             // A member with the same name doesn't exist, copy the item and add it to this node as
             // a new member
-            setMember(name, *memberOther);
+            auto clonedMember = memberOther->clone();
+            clonedMember->setParent(this);
+            clonedMember->m_name = name;
+
+            const int unresolvedCountDelta = unresolvedCount(*clonedMember);
+            m_members.emplace(it, name, std::move(clonedMember));
+
+            updateUnresolvedCount(unresolvedCountDelta);
             continue;
         }
 
         // Apply other node's item to this node
+        ConfigNode *memberThis = it->second.get();
+
         if (memberThis->isValue() && memberOther->isValue())
         {
             // Overwrite this node's value with the other node's value
-            memberThis->toValue().setValue(memberOther->toValue().value());
+            memberThis->toValue().setValue(memberOther->toValue());
         }
         else if (memberThis->isObject() && memberOther->isObject())
         {
@@ -276,8 +569,530 @@ void ConfigObjectNode::apply(const ConfigObjectNode &other)
         {
             // For all other type combinations just overwrite this node's member with the other
             // node's member
-            setMember(name, *memberOther);
+            auto clonedMember = memberOther->clone();
+            clonedMember->setParent(this);
+            clonedMember->m_name = name;
+
+            const int unresolvedCountDelta =
+                    unresolvedCount(*clonedMember) - unresolvedCount(*memberThis);
+            it->second = std::move(clonedMember);
+
+            updateUnresolvedCount(unresolvedCountDelta);
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::apply(ConfigObjectNode &&other)
+{
+    if (&other == this)
+    {
+        // Applying the node to itself would not change anything
+        return;
+    }
+
+    detach();
+    other.detach();
+    invalidateSharedMembers();
+
+    // Merge nodes (both member containers are sorted by name so each of the other node's members
+    // only needs to be searched for after the position of the previously applied member)
+    size_t position = 0U;
+
+    for (auto &otherMember : other.m_members)
+    {
+        const QString &name = otherMember.first;
+        ConfigNode *memberOther = otherMember.second.get();
+        Q_ASSERT(memberOther != nullptr);
+
+        // Check if a member with the same name already exists
+        auto it = std::lower_bound(m_members.begin() + static_cast<std::ptrdiff_t>(position),
+                                   m_members.end(),
+                                   name,
+                                   isMemberNameLess<QString>);
+        position = static_cast<size_t>(it - m_members.begin()) + 1U;
+
+        if ((it == m_members.end()) || (it->first != name))
+        {
+            // A member with the same name doesn't exist, move the item to this node as a new member
+            memberOther->setParent(this);
+
+            const int unresolvedCountDelta = unresolvedCount(*memberOther);
+            m_members.emplace(it, name, std::move(otherMember.second));
+
+            updateUnresolvedCount(unresolvedCountDelta);
+            continue;
+        }
+
+        // Apply other node's item to this node
+        ConfigNode *memberThis = it->second.get();
+
+        if (memberThis->isValue() && memberOther->isValue())
+        {
+            // Overwrite this node's value with the other node's value
+            memberThis->toValue().setValue(memberOther->toValue());
+        }
+        else if (memberThis->isObject() && memberOther->isObject())
+        {
+            // Merge object items
+            memberThis->toObject().apply(std::move(memberOther->toObject()));
+        }
+        else
+        {
+            // For all other type combinations just overwrite this node's member with the other
+            // node's member
+            memberOther->setParent(this);
+
+            const int unresolvedCountDelta =
+                    unresolvedCount(*memberOther) - unresolvedCount(*memberThis);
+            it->second = std::move(otherMember.second);
+
+            updateUnresolvedCount(unresolvedCountDelta);
+        }
+    }
+
+    // The other node is left without members
+    other.removeAll();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigObjectNode::createLayered(
+        const std::vector<const ConfigObjectNode *> &layers)
+{
+    auto layeredNode = std::make_unique<ConfigObjectNode>(nullptr);
+
+    if (layers.empty())
+    {
+        return layeredNode;
+    }
+
+    // The number of unresolved nodes in the layered node is known without merging the layers only
+    // if the last layer is the only one which can contain them (its members override all others)
+    const bool lowerLayersResolved = std::all_of(layers.begin(),
+                                                 layers.end() - 1,
+                                                 [](const ConfigObjectNode *layer)
+                                                 {
+                                                     return (layer->unresolvedCount() == 0);
+                                                 });
+
+    if (!lowerLayersResolved)
+    {
+        for (const auto *layer : layers)
+        {
+            layeredNode->apply(*layer);
+        }
+
+        return layeredNode;
+    }
+
+    for (const auto *layer : layers)
+    {
+        Q_ASSERT(layer != nullptr);
+
+        if (layer->count() > 0)
+        {
+            layeredNode->m_layers.push_back(layer->sharedMembers());
+        }
+    }
+
+    if (layeredNode->m_layers.size() == 1U)
+    {
+        // A single layer is the same as a clone
+        layeredNode->m_sharedMembers = layeredNode->m_layers.front();
+    }
+
+    layeredNode->m_unresolvedCount = layers.back()->unresolvedCount();
+    return layeredNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::flatten()
+{
+    detach();
+    invalidateSharedMembers();
+
+    for (auto &member : m_members)
+    {
+        if (member.second->isObject())
+        {
+            member.second->toObject().flatten();
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigObjectNode::deepClone() const
+{
+    auto clonedNode = std::make_unique<ConfigObjectNode>(nullptr);
+    const auto &memberList = members();
+    clonedNode->m_members.reserve(memberList.size());
+
+    for (const auto &member : memberList)
+    {
+        std::unique_ptr<ConfigNode> clonedMember;
+
+        switch (member.second->type())
+        {
+            case ConfigNode::Type::Object:
+            {
+                clonedMember = member.second->toObject().deepClone();
+                break;
+            }
+
+            case ConfigNode::Type::DerivedObject:
+            {
+                const auto &derivedObject = member.second->toDerivedObject();
+                clonedMember = std::make_unique<ConfigDerivedObjectNode>(
+                                   derivedObject.bases(),
+                                   *derivedObject.config().deepClone());
+                break;
+            }
+
+            default:
+            {
+                // Value and NodeReference nodes do not share any nodes
+                clonedMember = member.second->clone();
+                break;
+            }
+        }
+
+        clonedMember->setParent(clonedNode.get());
+        clonedMember->m_name = member.first;
+        clonedNode->m_members.emplace_back(member.first, std::move(clonedMember));
+    }
+
+    clonedNode->m_unresolvedCount = m_unresolvedCount;
+    return clonedNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Name>
+bool ConfigObjectNode::isMemberNameLess(const Member &member, const Name &name)
+{
+    return isNameLess(member.first, name);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Name>
+std::vector<ConfigObjectNode::Member>::const_iterator ConfigObjectNode::lowerBound(
+        const Name &name) const
+{
+    detach();
+    return std::lower_bound(m_members.begin(), m_members.end(), name, isMemberNameLess<Name>);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Name>
+std::vector<ConfigObjectNode::Member>::iterator ConfigObjectNode::lowerBound(const Name &name)
+{
+    detach();
+    return std::lower_bound(m_members.begin(), m_members.end(), name, isMemberNameLess<Name>);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Name>
+std::vector<ConfigObjectNode::Member>::const_iterator ConfigObjectNode::find(
+        const Name &name) const
+{
+    auto it = lowerBound(name);
+
+    if ((it != m_members.end()) && isNameEqual(it->first, name))
+    {
+        return it;
+    }
+
+    return m_members.end();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Name>
+std::vector<ConfigObjectNode::Member>::iterator ConfigObjectNode::find(const Name &name)
+{
+    auto it = lowerBound(name);
+
+    if ((it != m_members.end()) && isNameEqual(it->first, name))
+    {
+        return it;
+    }
+
+    return m_members.end();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Name>
+bool ConfigObjectNode::containsMember(const Name &name) const
+{
+    const auto &memberList = members();
+    auto it = std::lower_bound(memberList.begin(),
+                               memberList.end(),
+                               name,
+                               isMemberNameLess<Name>);
+
+    return ((it != memberList.end()) && isNameEqual(it->first, name));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Name>
+bool ConfigObjectNode::storeMember(const Name &name, std::unique_ptr<ConfigNode> node)
+{
+    // Make sure that name and node are both valid
+    if ((!isNameValid(name)) || (!node))
+    {
+        return false;
+    }
+
+    // Set the parent of the node
+    detach();
+    invalidateSharedMembers();
+
+    node->setParent(this);
+
+    // Insert or replace the member (the name of the node shares the string with the member)
+    int unresolvedCountDelta = unresolvedCount(*node);
+    auto it = lowerBound(name);
+
+    if ((it == m_members.end()) || (!isNameEqual(it->first, name)))
+    {
+        // Insert a new item
+        const QString memberName = toNameString(name);
+        node->m_name = memberName;
+        m_members.emplace(it, memberName, std::move(node));
+    }
+    else
+    {
+        // Replace the existing item
+        node->m_name = it->first;
+        unresolvedCountDelta -= unresolvedCount(*it->second);
+        it->second = std::move(node);
+    }
+
+    updateUnresolvedCount(unresolvedCountDelta);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const std::vector<ConfigObjectNode::Member> &ConfigObjectNode::members() const
+{
+    if (m_layers.size() > 1U)
+    {
+        // Multiple layers have to be merged to get the members
+        mergeLayers();
+    }
+
+    return m_layers.empty() ? m_members : *m_layers.front();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::detach() const
+{
+    if (m_layers.empty())
+    {
+        return;
+    }
+
+    if (m_layers.size() > 1U)
+    {
+        mergeLayers();
+        return;
+    }
+
+    // The shared members are immutable so they are cloned (shared Object members are just shared
+    // again one level deeper)
+    auto *self = const_cast<ConfigObjectNode *>(this);
+    m_members.reserve(m_sharedMembers->size());
+
+    for (const auto &member : *m_sharedMembers)
+    {
+        auto clonedMember = member.second->clone();
+        clonedMember->setParent(self);
+        clonedMember->m_name = member.first;
+        m_members.emplace_back(member.first, std::move(clonedMember));
+    }
+
+    // The shared members are kept since they still match the members of this node
+    m_layers.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::mergeLayers() const
+{
+    Q_ASSERT(m_layers.size() > 1U);
+
+    // Find the nodes in the layers that make up each of the members: an Object member is merged
+    // with the Object members of the same name in the lower layers, while a member of any other
+    // type hides all of the members of the same name in the lower layers
+    struct LayeredMember
+    {
+        QString name;
+        std::vector<const ConfigNode *> nodes;
+    };
+
+    std::vector<LayeredMember> layeredMembers;
+
+    for (const auto &layer : m_layers)
+    {
+        size_t position = 0U;
+
+        for (const auto &member : *layer)
+        {
+            const ConfigNode *node = member.second.get();
+            auto it = std::lower_bound(layeredMembers.begin() +
+                                       static_cast<std::ptrdiff_t>(position),
+                                       layeredMembers.end(),
+                                       member.first,
+                                       [](const LayeredMember &layeredMember, const QString &name)
+                                       {
+                                           return (layeredMember.name < name);
+                                       });
+            position = static_cast<size_t>(it - layeredMembers.begin()) + 1U;
+
+            if ((it == layeredMembers.end()) || (it->name != member.first))
+            {
+                layeredMembers.insert(it, LayeredMember { member.first, { node } });
+            }
+            else if (node->isObject() && it->nodes.back()->isObject())
+            {
+                it->nodes.push_back(node);
+            }
+            else
+            {
+                it->nodes.assign(1U, node);
+            }
+        }
+    }
+
+    // Create the members (an Object member found in multiple layers is layered from the shared
+    // members of its nodes in the layers)
+    auto *self = const_cast<ConfigObjectNode *>(this);
+    m_members.reserve(layeredMembers.size());
+
+    for (const auto &layeredMember : layeredMembers)
+    {
+        std::unique_ptr<ConfigNode> memberNode;
+
+        if (layeredMember.nodes.size() == 1U)
+        {
+            memberNode = layeredMember.nodes.front()->clone();
         }
+        else
+        {
+            auto objectNode = std::make_unique<ConfigObjectNode>(nullptr);
+            objectNode->m_layers.reserve(layeredMember.nodes.size());
+
+            for (const ConfigNode *node : layeredMember.nodes)
+            {
+                objectNode->m_layers.push_back(node->toObject().sharedMembers());
+            }
+
+            const auto &topLayerNode = layeredMember.nodes.back()->toObject();
+            objectNode->m_unresolvedCount = topLayerNode.m_unresolvedCount;
+            memberNode = std::move(objectNode);
+        }
+
+        memberNode->setParent(self);
+        memberNode->m_name = layeredMember.name;
+        m_members.emplace_back(layeredMember.name, std::move(memberNode));
+    }
+
+    // The merged members do not match any shared members
+    m_layers.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const ConfigObjectNode::SharedMembers> ConfigObjectNode::sharedMembers() const
+{
+    if (m_layers.size() > 1U)
+    {
+        // Only the merged members can be shared
+        mergeLayers();
+    }
+
+    if (!m_sharedMembers)
+    {
+        // Create an immutable copy of the members, the Object members are cloned so they share
+        // their own immutable copies of their members
+        auto sharedMembers = std::make_shared<SharedMembers>();
+        sharedMembers->reserve(m_members.size());
+
+        for (const auto &member : m_members)
+        {
+            sharedMembers->emplace_back(member.first, member.second->clone());
+        }
+
+        m_sharedMembers = std::move(sharedMembers);
+    }
+
+    return m_sharedMembers;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::invalidateSharedMembers()
+{
+    // The shared members of a node are created only after the ones of all of its Object members, so
+    // there is no need to go further up once a node without them is found
+    for (ConfigObjectNode *node = this;
+         (node != nullptr) && node->m_sharedMembers;
+         node = node->parent())
+    {
+        Q_ASSERT(node->m_layers.empty());
+        node->m_sharedMembers.reset();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigObjectNode::unresolvedCount(const ConfigNode &node)
+{
+    switch (node.type())
+    {
+        case ConfigNode::Type::Object:
+        {
+            return node.toObject().m_unresolvedCount;
+        }
+
+        case ConfigNode::Type::NodeReference:
+        case ConfigNode::Type::DerivedObject:
+        {
+            return 1;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::updateUnresolvedCount(const int delta)
+{
+    if (delta == 0)
+    {
+        return;
+    }
+
+    for (ConfigObjectNode *node = this; node != nullptr; node = node->parent())
+    {
+        node->m_unresolvedCount += delta;
     }
 }
 
@@ -26,18 +26,28 @@
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigReaderRegistry.hpp>
+#include <CppConfigFramework/ConfigTracer.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
+#include <QtCore/QHash>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QRunnable>
 
 // System includes
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <typeinfo>
 
 // Forward declarations
 
@@ -48,14 +58,348 @@
 namespace CppConfigFramework
 {
 
+namespace
+{
+
+//! Runs a function in a thread pool
+class FunctionTask : public QRunnable
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   function    Function to run
+     */
+    explicit FunctionTask(std::function<void()> function)
+        : m_function(std::move(function))
+    {
+    }
+
+    //! \copydoc    QRunnable::run()
+    void run() override
+    {
+        m_function();
+    }
+
+private:
+    //! Holds the function to run
+    std::function<void()> m_function;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the precedence of a member name decorator
+ *
+ * \param   decorator   Decorator (null for a member name without a decorator)
+ *
+ * \return  Precedence of the decorator
+ *
+ * When the same member is set with different decorators the member with the highest precedence is
+ * used. The precedences follow the order in which a QJsonObject holds its keys (a member without a
+ * decorator is last), so both parsers give the same result regardless of the member order.
+ */
+int decoratorPrecedence(const QChar decorator)
+{
+    switch (decorator.toLatin1())
+    {
+        case '#':
+        {
+            return 0;
+        }
+
+        case '$':
+        {
+            return 1;
+        }
+
+        case '&':
+        {
+            return 2;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return 3;
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+
+class ConfigReader::IncludePrefetch
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   filePath                Absolute path to the configuration file
+     * \param   streamingParserEnabled  Flag which tells if the streaming parser shall be used
+     */
+    IncludePrefetch(const QString &filePath, const bool streamingParserEnabled);
+
+    /*!
+     * Gets the absolute path to the configuration file
+     *
+     * \return  Absolute file path
+     */
+    const QString &filePath() const;
+
+    //! Loads and parses the configuration file (if it was not done yet)
+    void load();
+
+    /*!
+     * Takes the loaded configuration file
+     *
+     * \param[out]  parsedFile  Output for the loaded configuration file
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (file could not be loaded or it was already taken)
+     *
+     * If loading of the file was not started in the thread pool yet then it is loaded in the
+     * calling thread, otherwise this method waits until it is loaded.
+     */
+    bool takeResult(ParsedFile *parsedFile);
+
+private:
+    //! Holds the absolute path to the configuration file
+    const QString m_filePath;
+
+    //! Holds the flag which tells if the streaming parser shall be used
+    const bool m_streamingParserEnabled;
+
+    //! Holds the mutex for the loading of the file
+    QMutex m_mutex;
+
+    //! Holds the flag which tells if the loading of the file was finished
+    bool m_finished = false;
+
+    //! Holds the flag which tells if the file was loaded and is available
+    bool m_loaded = false;
+
+    //! Holds the loaded configuration file
+    ParsedFile m_parsedFile;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReader::IncludePrefetch::IncludePrefetch(const QString &filePath,
+                                               const bool streamingParserEnabled)
+    : m_filePath(filePath),
+      m_streamingParserEnabled(streamingParserEnabled)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QString &ConfigReader::IncludePrefetch::filePath() const
+{
+    return m_filePath;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::IncludePrefetch::load()
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_finished)
+    {
+        return;
+    }
+
+    // The file is never memory-mapped here because the mapping would be owned by another thread.
+    // In case of an error the file is just loaded again when it is read so the error gets reported.
+    QString errorString;
+    m_loaded = loadFile(m_filePath, false, &m_parsedFile, &errorString);
+
+    if (m_loaded)
+    {
+        parseFile(m_streamingParserEnabled, &m_parsedFile);
+    }
+
+    m_finished = true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::IncludePrefetch::takeResult(ParsedFile *parsedFile)
+{
+    load();
+
+    QMutexLocker locker(&m_mutex);
+
+    if (!m_loaded)
+    {
+        return false;
+    }
+
+    *parsedFile = std::move(m_parsedFile);
+    m_loaded = false;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::isStreamingParserEnabled() const
+{
+    return m_streamingParserEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setStreamingParserEnabled(const bool enabled)
+{
+    m_streamingParserEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::isMemoryMappingEnabled() const
+{
+    return m_memoryMappingEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setMemoryMappingEnabled(const bool enabled)
+{
+    m_memoryMappingEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<ConfigIncludeCache> ConfigReader::includeCache() const
+{
+    return m_includeCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setIncludeCache(const std::shared_ptr<ConfigIncludeCache> &includeCache)
+{
+    m_includeCache = includeCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::isParallelIncludesEnabled() const
+{
+    return m_parallelIncludesEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setParallelIncludesEnabled(const bool enabled)
+{
+    m_parallelIncludesEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QThreadPool *ConfigReader::includeThreadPool() const
+{
+    return m_includeThreadPool;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setIncludeThreadPool(QThreadPool *threadPool)
+{
+    m_includeThreadPool = threadPool;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::isPartialParsingEnabled() const
+{
+    return m_partialParsingEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setPartialParsingEnabled(const bool enabled)
+{
+    m_partialParsingEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<ConfigNameTable> ConfigReader::nameTable() const
+{
+    return m_nameTable;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setNameTable(const std::shared_ptr<ConfigNameTable> &nameTable)
+{
+    m_nameTable = nameTable;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::isArenaAllocationEnabled() const
+{
+    return m_arenaAllocationEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setArenaAllocationEnabled(const bool enabled)
+{
+    m_arenaAllocationEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         const QString &filePath,
         const QDir &workingDir,
         const ConfigNodePath &sourceNodePath,
         const ConfigNodePath &destinationNodePath,
         const std::vector<const ConfigObjectNode *> &externalConfigs,
-        EnvironmentVariables *environmentVariables) const
+        EnvironmentVariables *environmentVariables,
+        ReadStatistics *statistics) const
+{
+    const auto arena = createArena();
+
+    return readFile(filePath,
+                    workingDir,
+                    sourceNodePath,
+                    destinationNodePath,
+                    externalConfigs,
+                    environmentVariables,
+                    statistics,
+                    nullptr,
+                    nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readFile(
+        const QString &filePath,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables,
+        ReadStatistics *statistics,
+        ConfigIncludeCache::Dependencies *dependencies,
+        IncludePrefetch *prefetch) const
 {
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+
+    if (statistics != nullptr)
+    {
+        statistics->reset();
+    }
+
     // Make sure that file path is not empty
     if (filePath.isEmpty())
     {
@@ -63,55 +407,66 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
-    // Expand references to environment variables in the file path
-    const QString expandedFilePath = environmentVariables->expandText(filePath);
+    // Prepare absolute path to the file
+    const QString absoluteFilePath = makeAbsoluteFilePath(filePath,
+                                                          workingDir,
+                                                          *environmentVariables);
 
-    if (expandedFilePath.isEmpty())
+    if (absoluteFilePath.isEmpty())
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Failed to expand file path:" << filePath;
         return {};
     }
 
-    // Prepare absolute path to the file using the working path if needed
-    QString absoluteFilePath;
+    ConfigTraceSpan traceSpan(QStringLiteral("reader"), QStringLiteral("Read file"));
 
-    if (QDir::isAbsolutePath(expandedFilePath))
+    if (traceSpan.isActive())
     {
-        absoluteFilePath = QDir::cleanPath(expandedFilePath);
+        traceSpan.setName(QStringLiteral("Read file: ") + QFileInfo(absoluteFilePath).fileName());
+        traceSpan.setArgument(QStringLiteral("file_path"), absoluteFilePath);
     }
-    else
+
+    // Take the file if it was already loaded in advance (its path could have changed in the
+    // meantime in which case it is loaded again) or load and parse it now
+    ParsedFile parsedFile;
+    bool fileLoaded = false;
+
+    if ((prefetch != nullptr) && (prefetch->filePath() == absoluteFilePath))
     {
-        absoluteFilePath = QDir::cleanPath(workingDir.absoluteFilePath(expandedFilePath));
+        fileLoaded = prefetch->takeResult(&parsedFile);
     }
 
-    // Open file
-    if (!QFile::exists(absoluteFilePath))
+    if (!fileLoaded)
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "File at path was not found:" << absoluteFilePath;
-        return {};
-    }
+        QString errorString;
+
+        if (!loadFile(absoluteFilePath, m_memoryMappingEnabled, &parsedFile, &errorString))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader) << errorString;
+            return {};
+        }
 
-    QFile file(absoluteFilePath);
+        parseFile(m_streamingParserEnabled, &parsedFile);
+    }
 
-    if (!file.open(QIODevice::ReadOnly))
+    if (dependencies != nullptr)
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to open file at path:" << absoluteFilePath;
-        return {};
+        dependencies->files.push_back(parsedFile.fileInfo);
     }
 
-    // Read the contents (JSON format)
-    QJsonParseError jsonParseError {};
-    const QByteArray fileContents = file.readAll();
-    const auto doc = QJsonDocument::fromJson(fileContents, &jsonParseError);
+    if (statistics != nullptr)
+    {
+        statistics->parseTime = totalTimer.nsecsElapsed();
+        statistics->bytesParsed += parsedFile.contents.size();
+    }
 
-    if (jsonParseError.error != QJsonParseError::NoError)
+    if (parsedFile.errorOffset >= 0)
     {
         constexpr int contextMaxLength = 20;
-        const int contextBeforeIndex = std::max(0, jsonParseError.offset - contextMaxLength);
-        const int contextBeforeLength = std::min(jsonParseError.offset, contextMaxLength);
+        const int errorOffset = parsedFile.errorOffset;
+        const int contextBeforeIndex = std::max(0, errorOffset - contextMaxLength);
+        const int contextBeforeLength = std::min(errorOffset, contextMaxLength);
 
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << QString("Failed to parse the file contents:"
@@ -121,16 +476,16 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
                            "\n    context before error: [%4]"
                            "\n    context at error: [%5]")
                    .arg(absoluteFilePath,
-                        QString::number(jsonParseError.offset),
-                        jsonParseError.errorString(),
-                        QString::fromUtf8(fileContents.mid(contextBeforeIndex,
-                                                           contextBeforeLength)),
-                        QString::fromUtf8(fileContents.mid(jsonParseError.offset,
-                                                           contextMaxLength)));
+                        QString::number(errorOffset),
+                        parsedFile.errorString,
+                        QString::fromUtf8(parsedFile.contents.mid(contextBeforeIndex,
+                                                                  contextBeforeLength)),
+                        QString::fromUtf8(parsedFile.contents.mid(errorOffset,
+                                                                  contextMaxLength)));
         return {};
     }
 
-    if (!doc.isObject())
+    if (!parsedFile.isObject)
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Config file does not contain a JSON object:" << absoluteFilePath;
@@ -138,12 +493,26 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
     }
 
     // Read the config
-    auto config = read(doc.object(),
-                       QFileInfo(absoluteFilePath).absoluteDir(),
-                       sourceNodePath,
-                       destinationNodePath,
-                       externalConfigs,
-                       environmentVariables);
+    JsonStreamReader streamReader(parsedFile.contents);
+    streamReader.setOffset(parsedFile.configMemberOffset);
+
+    auto config = readConfig(parsedFile.rootObject,
+                             m_streamingParserEnabled ? &streamReader : nullptr,
+                             QFileInfo(absoluteFilePath).absoluteDir(),
+                             sourceNodePath,
+                             destinationNodePath,
+                             externalConfigs,
+                             environmentVariables,
+                             statistics,
+                             dependencies);
+
+    // Release the memory-mapped file as soon as the configuration nodes are built (the data is not
+    // referenced by the nodes)
+    if (parsedFile.mappedFile)
+    {
+        parsedFile.contents.clear();
+        parsedFile.mappedFile.reset();
+    }
 
     if (!config)
     {
@@ -152,72 +521,327 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
+    if (statistics != nullptr)
+    {
+        statistics->totalTime = totalTimer.nsecsElapsed();
+    }
+
     return config;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigObjectNode> ConfigReader::read(
-        const QJsonObject &configObject,
-        const QDir &workingDir,
-        const ConfigNodePath &sourceNodePath,
-        const ConfigNodePath &destinationNodePath,
-        const std::vector<const ConfigObjectNode *> &externalConfigs,
-        EnvironmentVariables *environmentVariables) const
+bool ConfigReader::loadFile(const QString &absoluteFilePath,
+                            const bool memoryMappingEnabled,
+                            ParsedFile *parsedFile,
+                            QString *errorString)
 {
-    // Validate source node path
-    if ((!sourceNodePath.isAbsolute()) ||
-        (!sourceNodePath.isValid()))
+    // Open file
+    if (!QFile::exists(absoluteFilePath))
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Invalid source node path:" << sourceNodePath.path();
-        return {};
+        *errorString = QString("File at path was not found: %1").arg(absoluteFilePath);
+        return false;
     }
 
-    // Validate destination node
-    if ((!destinationNodePath.isAbsolute()) ||
-        (!destinationNodePath.isValid()))
+    auto file = std::make_unique<QFile>(absoluteFilePath);
+
+    if (!file->open(QIODevice::ReadOnly))
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Invalid destination node path:" << destinationNodePath.path();
-        return {};
+        *errorString = QString("Failed to open file at path: %1").arg(absoluteFilePath);
+        return false;
     }
 
-    // Check if environment variables were provided
-    if (environmentVariables == nullptr)
+    const QFileInfo fileInfo(*file);
+    parsedFile->fileInfo.filePath = absoluteFilePath;
+    parsedFile->fileInfo.size = fileInfo.size();
+    parsedFile->fileInfo.lastModified = fileInfo.lastModified();
+
+    // Read the contents (JSON format) either from the memory-mapped file or from its copy
+    uchar *mappedFileContents = nullptr;
+
+    if (memoryMappingEnabled &&
+        (file->size() > 0) &&
+        (file->size() <= static_cast<qint64>(std::numeric_limits<int>::max())))
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Environment variables are not provided!";
-        return {};
+        mappedFileContents = file->map(0, file->size());
     }
 
-    // Check external configs
-    for (const auto *externalConfig : externalConfigs)
+    if (mappedFileContents != nullptr)
     {
-        if (externalConfig == nullptr)
-        {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << "Invalid external configs";
-            return {};
-        }
-    }
+        parsedFile->contents =
+                QByteArray::fromRawData(reinterpret_cast<const char *>(mappedFileContents),
+                                        static_cast<int>(file->size()));
 
-    // Read 'environment_variables' member
-    if (!readEnvironmentVariablesMember(configObject, environmentVariables))
+        // The file is kept open until the contents are not needed anymore
+        parsedFile->mappedFile = std::move(file);
+    }
+    else
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to read the 'environment_variables' member";
-        return {};
+        parsedFile->contents = file->readAll();
     }
 
-    // Read 'includes' member
-    auto completeConfig = readIncludesMember(configObject,
-                                             workingDir,
-                                             externalConfigs,
-                                             environmentVariables);
+    return true;
+}
 
-    if (!completeConfig)
-    {
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::parseFile(const bool streamingParserEnabled, ParsedFile *parsedFile)
+{
+    if (streamingParserEnabled)
+    {
+        // Only the root object is scanned here, the 'config' member is read later directly from the
+        // file contents
+        JsonStreamReader streamReader(parsedFile->contents);
+        parsedFile->isObject = scanRootObject(&streamReader, &parsedFile->rootObject);
+        parsedFile->configMemberOffset = streamReader.offset();
+
+        if (streamReader.hasError())
+        {
+            parsedFile->errorOffset = streamReader.errorOffset();
+            parsedFile->errorString = streamReader.errorString();
+        }
+    }
+    else
+    {
+        QJsonParseError jsonParseError {};
+        const auto doc = QJsonDocument::fromJson(parsedFile->contents, &jsonParseError);
+
+        if (jsonParseError.error != QJsonParseError::NoError)
+        {
+            parsedFile->errorOffset = jsonParseError.offset;
+            parsedFile->errorString = jsonParseError.errorString();
+        }
+        else if (doc.isObject())
+        {
+            parsedFile->isObject = true;
+            parsedFile->rootObject = doc.object();
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::vector<std::shared_ptr<ConfigReader::IncludePrefetch>> ConfigReader::prefetchIncludes(
+        const QVector<QJsonObject> &includes,
+        const QDir &workingDir,
+        const EnvironmentVariables &environmentVariables) const
+{
+    std::vector<std::shared_ptr<IncludePrefetch>> prefetches(
+                static_cast<size_t>(includes.size()));
+
+    // The file paths are expanded with the environment variables that are known before any of the
+    // includes is processed (a copy is used so that the environment of the include stays intact)
+    EnvironmentVariables prefetchEnvironmentVariables = environmentVariables;
+    setCurrentDirectory(workingDir, &prefetchEnvironmentVariables);
+
+    auto *threadPool = (m_includeThreadPool != nullptr) ? m_includeThreadPool
+                                                        : QThreadPool::globalInstance();
+
+    for (int i = 0; i < includes.size(); i++)
+    {
+        const auto &includeObject = includes.at(i);
+
+        // Only the includes which are read by this reader can be prefetched (invalid includes are
+        // skipped here and reported when they are processed)
+        const QString type = includeObject.value(QStringLiteral("type"))
+                             .toString(QStringLiteral("CppConfigFramework"));
+        const auto *configReader = ConfigReaderRegistry::instance()->configReader(type);
+
+        if ((configReader == nullptr) || (typeid(*configReader) != typeid(ConfigReader)))
+        {
+            continue;
+        }
+
+        const QString absoluteFilePath =
+                makeAbsoluteFilePath(includeObject.value(QStringLiteral("file_path")).toString(),
+                                     workingDir,
+                                     prefetchEnvironmentVariables);
+
+        if (absoluteFilePath.isEmpty())
+        {
+            continue;
+        }
+
+        // The task holds only a weak reference so that a file which is not needed anymore (for
+        // example after a failed include) is not loaded
+        auto prefetch = std::make_shared<IncludePrefetch>(absoluteFilePath,
+                                                          m_streamingParserEnabled);
+        std::weak_ptr<IncludePrefetch> weakPrefetch = prefetch;
+
+        threadPool->start(new FunctionTask([weakPrefetch]()
+        {
+            auto prefetch = weakPrefetch.lock();
+
+            if (prefetch)
+            {
+                prefetch->load();
+            }
+        }));
+
+        prefetches[static_cast<size_t>(i)] = std::move(prefetch);
+    }
+
+    return prefetches;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::read(
+        const QJsonObject &configObject,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables,
+        ReadStatistics *statistics) const
+{
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+
+    if (statistics != nullptr)
+    {
+        statistics->reset();
+    }
+
+    const auto arena = createArena();
+
+    auto config = readConfig(configObject,
+                             nullptr,
+                             workingDir,
+                             sourceNodePath,
+                             destinationNodePath,
+                             externalConfigs,
+                             environmentVariables,
+                             statistics,
+                             nullptr);
+
+    if (config && (statistics != nullptr))
+    {
+        statistics->totalTime = totalTimer.nsecsElapsed();
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::read(
+        const QDir &workingDir,
+        const ConfigNodePath &destinationNodePath,
+        const QJsonObject &otherParameters,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    const auto arena = createArena();
+
+    return readInclude(workingDir,
+                       destinationNodePath,
+                       otherParameters,
+                       externalConfigs,
+                       environmentVariables,
+                       nullptr,
+                       nullptr,
+                       nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigReader::internName(const QString &name) const
+{
+    return m_nameTable ? m_nameTable->intern(name) : name;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigNodeArena> ConfigReader::createArena() const
+{
+    // Nested read procedures (for example includes read through the registry) use the arena of the
+    // outermost read procedure
+    if ((!m_arenaAllocationEnabled) || (ConfigNodeArena::active() != nullptr))
+    {
+        return {};
+    }
+
+    return std::make_unique<ConfigNodeArena>();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readConfig(
+        const QJsonObject &configObject,
+        JsonStreamReader *configMemberReader,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables,
+        ReadStatistics *statistics,
+        ConfigIncludeCache::Dependencies *dependencies) const
+{
+    // Validate source node path
+    if ((!sourceNodePath.isAbsolute()) ||
+        (!sourceNodePath.isValid()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Invalid source node path:" << sourceNodePath.path();
+        return {};
+    }
+
+    // Validate destination node
+    if ((!destinationNodePath.isAbsolute()) ||
+        (!destinationNodePath.isValid()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Invalid destination node path:" << destinationNodePath.path();
+        return {};
+    }
+
+    // Check if environment variables were provided
+    if (environmentVariables == nullptr)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Environment variables are not provided!";
+        return {};
+    }
+
+    // Check external configs
+    for (const auto *externalConfig : externalConfigs)
+    {
+        if (externalConfig == nullptr)
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Invalid external configs";
+            return {};
+        }
+    }
+
+    // Read 'environment_variables' member
+    QElapsedTimer phaseTimer;
+    phaseTimer.start();
+
+    if (!readEnvironmentVariablesMember(configObject, environmentVariables))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to read the 'environment_variables' member";
+        return {};
+    }
+
+    if (statistics != nullptr)
+    {
+        statistics->environmentVariablesTime = phaseTimer.nsecsElapsed();
+        phaseTimer.start();
+    }
+
+    // Read 'includes' member
+    auto completeConfig = readIncludesMember(configObject,
+                                             workingDir,
+                                             externalConfigs,
+                                             environmentVariables,
+                                             statistics,
+                                             dependencies);
+
+    if (!completeConfig)
+    {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Failed to read the 'includes' member";
         return {};
@@ -231,15 +855,24 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
+    if (statistics != nullptr)
+    {
+        statistics->includesTime = phaseTimer.nsecsElapsed();
+    }
+
     // Make sure that the current directory environment variable contains the appropriate location
     // (at this point the value could point to the last include's directory)
     setCurrentDirectory(workingDir, environmentVariables);
 
     // Read 'config' member
     auto configMember = readConfigMember(configObject,
+                                         configMemberReader,
+                                         sourceNodePath,
                                          externalConfigs,
                                          *completeConfig,
-                                         *environmentVariables);
+                                         *environmentVariables,
+                                         statistics,
+                                         dependencies);
 
     if (!configMember)
     {
@@ -256,8 +889,16 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
-    // Apply the overloads from 'config' member to the read configuration
-    completeConfig->apply(*configMember);
+    // Apply the overloads from 'config' member to the read configuration (its nodes are moved since
+    // it is not needed anymore)
+    phaseTimer.start();
+    completeConfig->apply(std::move(*configMember));
+
+    if (statistics != nullptr)
+    {
+        statistics->applyTime = phaseTimer.nsecsElapsed();
+        phaseTimer.start();
+    }
 
     // Transform the configuration node based on source and destination node paths
     auto transformedConfig = transformConfig(std::move(completeConfig),
@@ -271,17 +912,85 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
+    if (statistics != nullptr)
+    {
+        statistics->transformTime = phaseTimer.nsecsElapsed();
+    }
+
     return transformedConfig;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigObjectNode> ConfigReader::read(
+bool ConfigReader::scanRootObject(JsonStreamReader *reader, QJsonObject *rootObject)
+{
+    if (reader->peekType() != QJsonValue::Object)
+    {
+        // Validate the data so that a syntax error is reported as such
+        reader->skipValue();
+        return false;
+    }
+
+    if (!reader->beginObject())
+    {
+        return false;
+    }
+
+    // Only the members needed before the 'config' member is read are stored, the 'config' member is
+    // just validated and its position is remembered
+    int configMemberOffset = -1;
+    QString name;
+
+    while (reader->nextMember(&name))
+    {
+        if (name == QLatin1String("config"))
+        {
+            configMemberOffset = reader->offset();
+
+            if (!reader->skipValue())
+            {
+                return false;
+            }
+        }
+        else if ((name == QLatin1String("environment_variables")) ||
+                 (name == QLatin1String("includes")))
+        {
+            const QJsonValue value = reader->readValue();
+
+            if (value.isUndefined())
+            {
+                return false;
+            }
+
+            rootObject->insert(name, value);
+        }
+        else if (!reader->skipValue())
+        {
+            return false;
+        }
+    }
+
+    if (!reader->readEnd())
+    {
+        return false;
+    }
+
+    // Position the reader at the 'config' member (or at the end if it is missing)
+    reader->setOffset((configMemberOffset >= 0) ? configMemberOffset : reader->offset());
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readInclude(
         const QDir &workingDir,
         const ConfigNodePath &destinationNodePath,
         const QJsonObject &otherParameters,
         const std::vector<const ConfigObjectNode *> &externalConfigs,
-        EnvironmentVariables *environmentVariables) const
+        EnvironmentVariables *environmentVariables,
+        ReadStatistics *statistics,
+        ConfigIncludeCache::Dependencies *dependencies,
+        IncludePrefetch *prefetch) const
 {
     // Extract file path
     QString filePath;
@@ -313,12 +1022,90 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
     }
 
     // Read the configuration file
-    return read(filePath,
-                workingDir,
-                sourceNodePath,
-                destinationNodePath,
-                externalConfigs,
-                environmentVariables);
+    if (!m_includeCache)
+    {
+        return readFile(filePath,
+                        workingDir,
+                        sourceNodePath,
+                        destinationNodePath,
+                        externalConfigs,
+                        environmentVariables,
+                        statistics,
+                        dependencies,
+                        prefetch);
+    }
+
+    // Try to take the configuration from the include cache
+    const QString absoluteFilePath = makeAbsoluteFilePath(filePath,
+                                                          workingDir,
+                                                          *environmentVariables);
+    ConfigIncludeCache::Dependencies includeDependencies;
+
+    if (!absoluteFilePath.isEmpty())
+    {
+        auto config = m_includeCache->find(absoluteFilePath,
+                                           sourceNodePath,
+                                           destinationNodePath,
+                                           externalConfigs,
+                                           environmentVariables,
+                                           &includeDependencies);
+
+        if (config)
+        {
+            if (statistics != nullptr)
+            {
+                statistics->includeCacheHits++;
+                statistics->clonesPerformed++;
+            }
+
+            if (dependencies != nullptr)
+            {
+                dependencies->merge(includeDependencies);
+            }
+
+            return config;
+        }
+    }
+
+    // Read the configuration file while recording everything that it depends on and then store it
+    // to the include cache
+    const EnvironmentVariables initialEnvironmentVariables = *environmentVariables;
+    environmentVariables->startAccessRecording();
+
+    auto config = readFile(absoluteFilePath.isEmpty() ? filePath : absoluteFilePath,
+                           workingDir,
+                           sourceNodePath,
+                           destinationNodePath,
+                           externalConfigs,
+                           environmentVariables,
+                           statistics,
+                           &includeDependencies,
+                           prefetch);
+
+    const EnvironmentVariables finalEnvironmentVariables = *environmentVariables;
+    const auto accessRecord = environmentVariables->stopAccessRecording();
+
+    if (!config)
+    {
+        return {};
+    }
+
+    m_includeCache->insert(absoluteFilePath,
+                           sourceNodePath,
+                           destinationNodePath,
+                           externalConfigs,
+                           initialEnvironmentVariables,
+                           finalEnvironmentVariables,
+                           accessRecord,
+                           includeDependencies,
+                           *config);
+
+    if (dependencies != nullptr)
+    {
+        dependencies->merge(includeDependencies);
+    }
+
+    return config;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -360,355 +1147,1007 @@ bool ConfigReader::readEnvironmentVariablesMember(const QJsonObject &rootObject,
         }
     }
 
-    return true;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
+        const QJsonObject &rootObject,
+        const QDir &workingDir,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables,
+        ReadStatistics *statistics,
+        ConfigIncludeCache::Dependencies *dependencies) const
+{
+    // Read included configurations
+    QVector<QJsonObject> includes;
+
+    if (!CedarFramework::deserializeOptionalNode(rootObject,
+                                                 QStringLiteral("includes"),
+                                                 &includes))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The 'includes' member in the root JSON Object is invalid";
+        return {};
+    }
+
+    auto includesConfig = std::make_unique<ConfigObjectNode>();
+
+    std::vector<const ConfigObjectNode *> extendedExternalConfigs;
+    extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
+    extendedExternalConfigs.push_back(includesConfig.get());
+    extendedExternalConfigs.insert(extendedExternalConfigs.end(),
+                                   externalConfigs.begin(),
+                                   externalConfigs.end());
+
+    // Start loading the included configuration files in parallel (the includes are still processed
+    // one after another in the declaration order)
+    std::vector<std::shared_ptr<IncludePrefetch>> prefetches;
+
+    if (m_parallelIncludesEnabled && (includes.size() > 1))
+    {
+        prefetches = prefetchIncludes(includes, workingDir, *environmentVariables);
+    }
+
+    for (int i = 0; i < includes.size(); i++)
+    {
+        const auto &includeObject = includes.at(i);
+
+        // Extract configuration file type
+        QString type = QStringLiteral("CppConfigFramework");
+
+        if (!CedarFramework::deserializeOptionalNode(includeObject,
+                                                     QStringLiteral("type"),
+                                                     &type))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("The 'type' member for include at index [%1] is invalid").arg(i);
+            return {};
+        }
+
+        if (type.isEmpty())
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("The 'type' member for include at index [%1] is empty").arg(i);
+            return {};
+        }
+
+        // Extract destination node
+        auto destinationNodePath = ConfigNodePath::ROOT_PATH;
+
+        if (!CedarFramework::deserializeOptionalNode(includeObject,
+                                                     QStringLiteral("destination_node"),
+                                                     &destinationNodePath))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("The 'destination_node' member for include at index [%1] is invalid")
+                       .arg(i);
+            return {};
+        }
+
+        if (destinationNodePath.isRelative() || (!destinationNodePath.isValid()))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("The 'destination_node' member [%1] for include at index [%2] "
+                               "is invalid")
+                       .arg(destinationNodePath.path())
+                       .arg(i);
+            return {};
+        }
+
+        // Update current directory environment variable
+        setCurrentDirectory(workingDir, environmentVariables);
+
+        ConfigTraceSpan traceSpan(QStringLiteral("reader"), QStringLiteral("Include"));
+
+        if (traceSpan.isActive())
+        {
+            traceSpan.setName(QString("Include [%1]: %2")
+                              .arg(i)
+                              .arg(includeObject.value(QStringLiteral("file_path")).toString()));
+            traceSpan.setArgument(QStringLiteral("index"), i);
+            traceSpan.setArgument(QStringLiteral("type"), type);
+            traceSpan.setArgument(QStringLiteral("file_path"),
+                                  includeObject.value(QStringLiteral("file_path")));
+            traceSpan.setArgument(QStringLiteral("destination_node"), destinationNodePath.path());
+        }
+
+        // Get the config reader for the include type
+        const auto *configReader = ConfigReaderRegistry::instance()->configReader(type);
+
+        if (configReader == nullptr)
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Unsupported configuration type [%1] for include at index [%2]")
+                       .arg(type)
+                       .arg(i);
+            return {};
+        }
+
+        // Read config file
+        // TODO: limit the includes depth to prevent an endless include loop?
+        std::unique_ptr<ConfigObjectNode> config;
+
+        if (typeid(*configReader) == typeid(ConfigReader))
+        {
+            // Use this reader so that its settings and statistics also cover the include
+            ReadStatistics includeStatistics;
+
+            config = readInclude(workingDir,
+                                 destinationNodePath,
+                                 includeObject,
+                                 extendedExternalConfigs,
+                                 environmentVariables,
+                                 (statistics != nullptr) ? &includeStatistics : nullptr,
+                                 dependencies,
+                                 prefetches.empty() ? nullptr
+                                                    : prefetches.at(static_cast<size_t>(i)).get());
+
+            if (statistics != nullptr)
+            {
+                statistics->mergeCounters(includeStatistics);
+            }
+        }
+        else
+        {
+            // The dependencies of other configuration types are not known so they are not cached
+            if (dependencies != nullptr)
+            {
+                dependencies->cacheable = false;
+            }
+
+            config = configReader->read(workingDir,
+                                        destinationNodePath,
+                                        includeObject,
+                                        extendedExternalConfigs,
+                                        environmentVariables);
+        }
+
+        if (!config)
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Failed to read config for include at index:" << i;
+            return {};
+        }
+
+        // Apply the config file contents to the "includes" configuration node (its nodes are moved
+        // since it is not needed anymore)
+        includesConfig->apply(std::move(*config));
+
+        if (statistics != nullptr)
+        {
+            statistics->includeFiles++;
+        }
+    }
+
+    return includesConfig;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigMember(
+        const QJsonObject &rootObject,
+        JsonStreamReader *configMemberReader,
+        const ConfigNodePath &sourceNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        const ConfigObjectNode &includesConfig,
+        const EnvironmentVariables &environmentVariables,
+        ReadStatistics *statistics,
+        ConfigIncludeCache::Dependencies *dependencies) const
+{
+    QElapsedTimer phaseTimer;
+    phaseTimer.start();
+
+    // The root object must contain the 'config' member (but it can be an empty object)
+    QJsonObject configObject;
+    int configMemberOffset = 0;
+
+    if (configMemberReader != nullptr)
+    {
+        switch (configMemberReader->peekType())
+        {
+            case QJsonValue::Null:
+            {
+                // No configuration
+                return std::make_unique<ConfigObjectNode>();
+            }
+
+            case QJsonValue::Object:
+            {
+                // The 'config' object is read directly from the stream
+                configMemberOffset = configMemberReader->offset();
+                break;
+            }
+
+            default:
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "The 'config' member in the root JSON Object is not a JSON Object!";
+                return {};
+            }
+        }
+    }
+    else
+    {
+        const auto configValue = rootObject.value(QStringLiteral("config"));
+
+        if (configValue.isNull())
+        {
+            // No configuration
+            return std::make_unique<ConfigObjectNode>();
+        }
+
+        if (!configValue.isObject())
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "The 'config' member in the root JSON Object is not a JSON Object!";
+            return {};
+        }
+
+        configObject = configValue.toObject();
+    }
+
+    // When only the source node is needed then just the nodes on its path, in its subtree and in
+    // the subtrees of the nodes that they (indirectly) reference are read. The referenced nodes
+    // are known only after the selected nodes are read, so the skipped members are recorded and the
+    // ones that become selected are read afterwards (the rest of the 'config' object is not parsed
+    // again) until the selection contains all of them.
+    std::vector<ConfigNodePath> selectedNodePaths;
+
+    if (m_partialParsingEnabled && (!sourceNodePath.isRoot()))
+    {
+        selectedNodePaths.push_back(
+                    normalizeReferencedNodePath(sourceNodePath, ConfigNodePath::ROOT_PATH));
+    }
+
+    const auto *selection = (selectedNodePaths.empty() ||
+                             (!selectedNodePaths.front().isValid())) ? nullptr
+                                                                     : &selectedNodePaths;
+    std::vector<SkippedMember> skippedMembers;
+
+    // Read 'config' object
+    std::unique_ptr<ConfigObjectNode> config;
+
+    if (configMemberReader != nullptr)
+    {
+        configMemberReader->setOffset(configMemberOffset);
+        config = readObjectNode(configMemberReader,
+                                ConfigNodePath::ROOT_PATH,
+                                environmentVariables,
+                                selection,
+                                &skippedMembers);
+    }
+    else
+    {
+        config = readObjectNode(configObject,
+                                ConfigNodePath::ROOT_PATH,
+                                environmentVariables,
+                                selection,
+                                &skippedMembers);
+    }
+
+    if (!config)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to read the 'config' member in the root JSON Object!";
+        return {};
+    }
+
+    // Read the skipped members that are referenced from the read nodes
+    while ((selection != nullptr) && extendNodeSelection(*config, &selectedNodePaths))
+    {
+        if (selectedNodePaths.empty())
+        {
+            // Referenced node paths could not be determined so all of the members are needed
+            selection = nullptr;
+        }
+
+        if (!readSkippedMembers(configMemberReader,
+                                environmentVariables,
+                                selection,
+                                &skippedMembers,
+                                config.get()))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Failed to read the 'config' member in the root JSON Object!";
+            return {};
+        }
+    }
+
+    if (statistics != nullptr)
+    {
+        statistics->nodesCreated += countNodes(*config);
+        statistics->configTime = phaseTimer.nsecsElapsed();
+    }
+
+    // Extend the external configs with the includesConfig
+    std::vector<const ConfigObjectNode *> extendedExternalConfigs;
+    extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
+    extendedExternalConfigs.push_back(&includesConfig);
+    extendedExternalConfigs.insert(extendedExternalConfigs.end(),
+                                   externalConfigs.begin(),
+                                   externalConfigs.end());
+
+    // Resolve references
+    phaseTimer.start();
+
+    if (!resolveReferences(extendedExternalConfigs,
+                           config.get(),
+                           statistics,
+                           (dependencies != nullptr) ? &dependencies->externalNodeLookups
+                                                     : nullptr))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to resolve references!";
+        return {};
+    }
+
+    if (statistics != nullptr)
+    {
+        statistics->referenceResolutionTime = phaseTimer.nsecsElapsed();
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigValueNode> ConfigReader::readValueNode(const QJsonValue &jsonValue,
+                                                             const ConfigNodePath &currentNodePath)
+{
+    Q_UNUSED(currentNodePath)
+
+    return std::make_unique<ConfigValueNode>(jsonValue);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
+        const QJsonObject &jsonObject,
+        const ConfigNodePath &currentNodePath,
+        const EnvironmentVariables &environmentVariables,
+        const std::vector<ConfigNodePath> *selectedNodePaths,
+        std::vector<SkippedMember> *skippedMembers) const
+{
+    auto objectNode = std::make_unique<ConfigObjectNode>();
+
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    {
+        QString memberName = it.key();
+
+        // Check for "decorators" in the member name (reference type or Value node)
+        QChar decorator;
+
+        if (hasDecorator(memberName))
+        {
+            decorator = memberName.at(0);
+            memberName = memberName.mid(1);
+        }
+
+        // Validate member name
+        if (!ConfigNodePath::validateNodeName(memberName))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Invalid member name [%1] in path [%2]")
+                       .arg(memberName, currentNodePath.path());
+            return {};
+        }
+
+        // Create a node based considering the decorator (unless it is not selected)
+        const ConfigNodePath memberNodePath = currentNodePath.append(memberName);
+        const MemberSelection selection = selectMember(memberNodePath, selectedNodePaths);
+
+        if (selection == MemberSelection::None)
+        {
+            if (skippedMembers != nullptr)
+            {
+                skippedMembers->push_back(
+                            { currentNodePath, memberName, decorator, -1, it.value() });
+            }
+
+            continue;
+        }
+
+        auto memberNode = readMemberNode(it.value(),
+                                         decorator,
+                                         memberNodePath,
+                                         selection,
+                                         environmentVariables,
+                                         selectedNodePaths,
+                                         skippedMembers);
+
+        if (!memberNode)
+        {
+            return {};
+        }
+
+        // Add member to the object
+        objectNode->setMember(internName(memberName), std::move(memberNode));
+    }
+
+    return objectNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigNode> ConfigReader::readMemberNode(
+        const QJsonValue &jsonValue,
+        const QChar decorator,
+        const ConfigNodePath &memberNodePath,
+        const MemberSelection selection,
+        const EnvironmentVariables &environmentVariables,
+        const std::vector<ConfigNodePath> *selectedNodePaths,
+        std::vector<SkippedMember> *skippedMembers) const
+{
+    Q_ASSERT(selection != MemberSelection::None);
+
+    switch (decorator.toLatin1())
+    {
+        case '#':
+        {
+            // Explicit Value node (even if it is a JSON Object type)
+            return readValueNode(jsonValue, memberNodePath);
+        }
+
+        case '$':
+        {
+            // Explicit Value node (even if it is a JSON Array or Object type) where references to
+            // environment variables in the value are resolved
+            const QJsonValue resolvedValue = resolveJsonValue(jsonValue, environmentVariables);
+
+            if (resolvedValue.isUndefined())
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Failed to resolve a Value node with references to environment "
+                           "variables:"
+                           "\n    member node path:" << memberNodePath.path();
+                return {};
+            }
+
+            return readValueNode(resolvedValue, memberNodePath);
+        }
+
+        case '&':
+        {
+            // One of the reference types
+            std::unique_ptr<ConfigNode> memberNode;
+
+            if (jsonValue.isString())
+            {
+                memberNode = readNodeReferenceNode(jsonValue.toString(), memberNodePath);
+            }
+            else if (jsonValue.isObject())
+            {
+                memberNode = readDerivedObjectNode(jsonValue.toObject(),
+                                                   memberNodePath,
+                                                   environmentVariables);
+            }
+            else
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Unsupported reference type at path:" << memberNodePath.path();
+                return {};
+            }
+
+            if (!memberNode)
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Failed to read the a NodeReference node member:"
+                           "\n    member node path:" << memberNodePath.path();
+            }
+
+            return memberNode;
+        }
+
+        default:
+        {
+            // No decorators, just an ordinary node
+            break;
+        }
+    }
+
+    if (!jsonValue.isObject())
+    {
+        return readValueNode(jsonValue, memberNodePath);
+    }
+
+    std::unique_ptr<ConfigNode> memberNode =
+            readObjectNode(jsonValue.toObject(),
+                           memberNodePath,
+                           environmentVariables,
+                           (selection == MemberSelection::Path) ? selectedNodePaths : nullptr,
+                           skippedMembers);
+
+    if (!memberNode)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to read the an ordinary Object node member:"
+                   "\n    member node path:" << memberNodePath.path();
+    }
+
+    return memberNode;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
-        const QJsonObject &rootObject,
-        const QDir &workingDir,
-        const std::vector<const ConfigObjectNode *> &externalConfigs,
-        EnvironmentVariables *environmentVariables) const
+std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
+        JsonStreamReader *reader,
+        const ConfigNodePath &currentNodePath,
+        const EnvironmentVariables &environmentVariables,
+        const std::vector<ConfigNodePath> *selectedNodePaths,
+        std::vector<SkippedMember> *skippedMembers) const
 {
-    // Read included configurations
-    QVector<QJsonObject> includes;
-
-    if (!CedarFramework::deserializeOptionalNode(rootObject,
-                                                 QStringLiteral("includes"),
-                                                 &includes))
+    if (!reader->beginObject())
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "The 'includes' member in the root JSON Object is invalid";
+                << QString("Failed to read an Object node at path [%1] (offset: %2): %3")
+                   .arg(currentNodePath.path())
+                   .arg(reader->errorOffset())
+                   .arg(reader->errorString());
         return {};
     }
 
-    auto includesConfig = std::make_unique<ConfigObjectNode>();
+    auto objectNode = std::make_unique<ConfigObjectNode>();
+    QString memberName;
 
-    std::vector<const ConfigObjectNode *> extendedExternalConfigs;
-    extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
-    extendedExternalConfigs.push_back(includesConfig.get());
-    extendedExternalConfigs.insert(extendedExternalConfigs.end(),
-                                   externalConfigs.begin(),
-                                   externalConfigs.end());
+    // Decorators of the decorated members (a member can be set with different decorators)
+    QHash<QString, QChar> memberDecorators;
 
-    for (int i = 0; i < includes.size(); i++)
+    while (reader->nextMember(&memberName))
     {
-        const auto &includeObject = includes.at(i);
-
-        // Extract configuration file type
-        QString type = QStringLiteral("CppConfigFramework");
+        // Check for "decorators" in the member name (reference type or Value node)
+        QChar decorator;
 
-        if (!CedarFramework::deserializeOptionalNode(includeObject,
-                                                     QStringLiteral("type"),
-                                                     &type))
+        if (hasDecorator(memberName))
         {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << QString("The 'type' member for include at index [%1] is invalid").arg(i);
-            return {};
+            decorator = memberName.at(0);
+            memberName = memberName.mid(1);
         }
 
-        if (type.isEmpty())
+        // Validate member name
+        if (!ConfigNodePath::validateNodeName(memberName))
         {
             qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << QString("The 'type' member for include at index [%1] is empty").arg(i);
+                    << QString("Invalid member name [%1] in path [%2]")
+                       .arg(memberName, currentNodePath.path());
             return {};
         }
 
-        // Extract destination node
-        auto destinationNodePath = ConfigNodePath::ROOT_PATH;
+        // Create a node based considering the decorator (unless it is not selected)
+        const ConfigNodePath memberNodePath = currentNodePath.append(memberName);
+        const MemberSelection selection = selectMember(memberNodePath, selectedNodePaths);
 
-        if (!CedarFramework::deserializeOptionalNode(includeObject,
-                                                     QStringLiteral("destination_node"),
-                                                     &destinationNodePath))
+        if (selection == MemberSelection::None)
         {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << QString("The 'destination_node' member for include at index [%1] is invalid")
-                       .arg(i);
-            return {};
+            // Only the offset of the value is kept so that it can be read later if needed
+            if (skippedMembers != nullptr)
+            {
+                skippedMembers->push_back(
+                            { currentNodePath, memberName, decorator, reader->offset(), {} });
+            }
+
+            if (!reader->skipValue())
+            {
+                break;
+            }
+
+            continue;
         }
 
-        if (destinationNodePath.isRelative() || (!destinationNodePath.isValid()))
+        auto memberNode = readMemberNode(reader,
+                                         decorator,
+                                         memberNodePath,
+                                         selection,
+                                         environmentVariables,
+                                         selectedNodePaths,
+                                         skippedMembers);
+
+        if (!memberNode)
         {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << QString("The 'destination_node' member [%1] for include at index [%2] "
-                               "is invalid")
-                       .arg(destinationNodePath.path())
-                       .arg(i);
             return {};
         }
 
-        // Update current directory environment variable
-        setCurrentDirectory(workingDir, environmentVariables);
-
-        // Read config file
-        // TODO: limit the includes depth to prevent an endless include loop?
-        auto config = ConfigReaderRegistry::instance()->readConfig(
-                          type,
-                          workingDir,
-                          destinationNodePath,
-                          includeObject,
-                          extendedExternalConfigs,
-                          environmentVariables);
+        // Add member to the object (unless the member is already set with a decorator of a higher
+        // precedence, the same as when the keys are visited in the order of a QJsonObject)
+        if (objectNode->contains(memberName) &&
+            (decoratorPrecedence(decorator) <
+             decoratorPrecedence(memberDecorators.value(memberName))))
+        {
+            continue;
+        }
 
-        if (!config)
+        if (decorator.isNull())
         {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << "Failed to read config for include at index:" << i;
-            return {};
+            memberDecorators.remove(memberName);
+        }
+        else
+        {
+            memberDecorators.insert(memberName, decorator);
         }
 
-        // Apply the config file contents to the "includes" configuration node
-        includesConfig->apply(*config);
+        objectNode->setMember(internName(memberName), std::move(memberNode));
     }
 
-    return includesConfig;
+    if (reader->hasError())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Failed to read an Object node at path [%1] (offset: %2): %3")
+                   .arg(currentNodePath.path())
+                   .arg(reader->errorOffset())
+                   .arg(reader->errorString());
+        return {};
+    }
+
+    return objectNode;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigMember(
-        const QJsonObject &rootObject,
-        const std::vector<const ConfigObjectNode *> &externalConfigs,
-        const ConfigObjectNode &includesConfig,
-        const EnvironmentVariables &environmentVariables) const
+std::unique_ptr<ConfigNode> ConfigReader::readMemberNode(
+        JsonStreamReader *reader,
+        const QChar decorator,
+        const ConfigNodePath &memberNodePath,
+        const MemberSelection selection,
+        const EnvironmentVariables &environmentVariables,
+        const std::vector<ConfigNodePath> *selectedNodePaths,
+        std::vector<SkippedMember> *skippedMembers) const
 {
-    // The root object must contain the 'config' member (but it can be an empty object)
-    const auto configValue = rootObject.value(QStringLiteral("config"));
+    Q_ASSERT(selection != MemberSelection::None);
 
-    if (configValue.isNull())
+    std::unique_ptr<ConfigNode> memberNode;
+
+    if (decorator == QLatin1Char('&'))
     {
-        // No configuration
-        return std::make_unique<ConfigObjectNode>();
+        // One of the reference types
+        switch (reader->peekType())
+        {
+            case QJsonValue::Object:
+            {
+                memberNode = readDerivedObjectNode(reader, memberNodePath, environmentVariables);
+
+                if (!memberNode)
+                {
+                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                            << "Failed to read the a NodeReference node member:"
+                               "\n    member node path:" << memberNodePath.path();
+                }
+
+                return memberNode;
+            }
+
+            case QJsonValue::String:
+            case QJsonValue::Undefined:
+            {
+                // NodeReference node (or an error in the stream which is reported below)
+                break;
+            }
+
+            default:
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Unsupported reference type at path:" << memberNodePath.path();
+                return {};
+            }
+        }
     }
+    else if (decorator.isNull() && (reader->peekType() == QJsonValue::Object))
+    {
+        // Ordinary Object node
+        memberNode = readObjectNode(reader,
+                                    memberNodePath,
+                                    environmentVariables,
+                                    (selection == MemberSelection::Path) ? selectedNodePaths
+                                                                         : nullptr,
+                                    skippedMembers);
+
+        if (!memberNode)
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Failed to read the an ordinary Object node member:"
+                       "\n    member node path:" << memberNodePath.path();
+        }
 
-    if (!configValue.isObject())
+        return memberNode;
+    }
+    else
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "The 'config' member in the root JSON Object is not a JSON Object!";
-        return {};
+        // The rest of the member types are read from the JSON Value
     }
 
-    // Read 'config' object
-    auto config = readObjectNode(configValue.toObject(),
-                                 ConfigNodePath::ROOT_PATH,
-                                 environmentVariables);
+    const QJsonValue value = reader->readValue();
 
-    if (!config)
+    if (value.isUndefined())
     {
+        // Reading of the member value from the stream failed
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to read the 'config' member in the root JSON Object!";
+                << QString("Failed to read the member at path [%1] (offset: %2): %3")
+                   .arg(memberNodePath.path())
+                   .arg(reader->errorOffset())
+                   .arg(reader->errorString());
         return {};
     }
 
-    // Extend the external configs with the includesConfig
-    std::vector<const ConfigObjectNode *> extendedExternalConfigs;
-    extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
-    extendedExternalConfigs.push_back(&includesConfig);
-    extendedExternalConfigs.insert(extendedExternalConfigs.end(),
-                                   externalConfigs.begin(),
-                                   externalConfigs.end());
+    return readMemberNode(value,
+                          decorator,
+                          memberNodePath,
+                          selection,
+                          environmentVariables,
+                          selectedNodePaths,
+                          skippedMembers);
+}
 
-    // Resolve references
-    if (!resolveReferences(extendedExternalConfigs, config.get()))
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::readSkippedMembers(JsonStreamReader *configMemberReader,
+                                      const EnvironmentVariables &environmentVariables,
+                                      const std::vector<ConfigNodePath> *selectedNodePaths,
+                                      std::vector<SkippedMember> *skippedMembers,
+                                      ConfigObjectNode *config) const
+{
+    std::vector<SkippedMember> remainingMembers;
+    remainingMembers.reserve(skippedMembers->size());
+
+    // Decorators of the read members (a member can be set with different decorators)
+    QHash<QString, QChar> memberDecorators;
+
+    for (const auto &skippedMember : *skippedMembers)
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to resolve references!";
-        return {};
+        const ConfigNodePath memberNodePath =
+                skippedMember.parentNodePath.append(skippedMember.name);
+        const MemberSelection selection = selectMember(memberNodePath, selectedNodePaths);
+
+        if (selection == MemberSelection::None)
+        {
+            remainingMembers.push_back(skippedMember);
+            continue;
+        }
+
+        // Read the member (the members skipped inside of it are added to the remaining members)
+        std::unique_ptr<ConfigNode> memberNode;
+
+        if (configMemberReader != nullptr)
+        {
+            configMemberReader->setOffset(skippedMember.offset);
+            memberNode = readMemberNode(configMemberReader,
+                                        skippedMember.decorator,
+                                        memberNodePath,
+                                        selection,
+                                        environmentVariables,
+                                        selectedNodePaths,
+                                        &remainingMembers);
+        }
+        else
+        {
+            memberNode = readMemberNode(skippedMember.value,
+                                        skippedMember.decorator,
+                                        memberNodePath,
+                                        selection,
+                                        environmentVariables,
+                                        selectedNodePaths,
+                                        &remainingMembers);
+        }
+
+        if (!memberNode)
+        {
+            return false;
+        }
+
+        // Add member to its parent which was read together with the skipped member (unless the
+        // member is already set with a decorator of a higher precedence)
+        auto *parentNode = config->nodeAtPath(skippedMember.parentNodePath);
+        Q_ASSERT((parentNode != nullptr) && parentNode->isObject());
+
+        auto &parentObjectNode = parentNode->toObject();
+        const QString memberNodePathValue = memberNodePath.path();
+
+        if (parentObjectNode.contains(skippedMember.name) &&
+            (decoratorPrecedence(skippedMember.decorator) <
+             decoratorPrecedence(memberDecorators.value(memberNodePathValue))))
+        {
+            continue;
+        }
+
+        memberDecorators.insert(memberNodePathValue, skippedMember.decorator);
+        parentObjectNode.setMember(internName(skippedMember.name), std::move(memberNode));
     }
 
-    return config;
+    *skippedMembers = std::move(remainingMembers);
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigValueNode> ConfigReader::readValueNode(const QJsonValue &jsonValue,
-                                                             const ConfigNodePath &currentNodePath)
+std::unique_ptr<ConfigNodeReference> ConfigReader::readNodeReferenceNode(
+        const QString &reference, const ConfigNodePath &currentNodePath)
 {
-    Q_UNUSED(currentNodePath)
+    const ConfigNodePath referencePath(reference);
 
-    return std::make_unique<ConfigValueNode>(jsonValue);
+    if (!referencePath.toAbsolute(currentNodePath).isValid())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Invalid node reference [%1] with current path [%2]")
+                   .arg(reference, currentNodePath.path());
+        return {};
+    }
+
+    return std::make_unique<ConfigNodeReference>(referencePath);
 }
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
+std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
         const QJsonObject &jsonObject,
         const ConfigNodePath &currentNodePath,
-        const EnvironmentVariables &environmentVariables)
+        const EnvironmentVariables &environmentVariables) const
 {
-    auto objectNode = std::make_unique<ConfigObjectNode>();
+    // Extract bases
+    QList<ConfigNodePath> bases;
 
-    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    if (!readDerivedObjectBases(jsonObject.value(QStringLiteral("base")), currentNodePath, &bases))
     {
-        QString memberName = it.key();
+        return {};
+    }
 
-        // Check for "decorators" in the member name (reference type or Value node)
-        QChar decorator;
+    // Extract config
+    auto config = std::make_unique<ConfigObjectNode>();
+    const auto configValue = jsonObject.value(QStringLiteral("config"));
 
-        if (hasDecorator(memberName))
+    switch (configValue.type())
+    {
+        case QJsonValue::Object:
         {
-            decorator = memberName.at(0);
-            memberName = memberName.mid(1);
+            // Read overrides for the object derived from bases
+            config = readObjectNode(configValue.toObject(), currentNodePath, environmentVariables);
+
+            if (!config)
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Failed to read the overrides for the object derived from bases at path:"
+                           "\n    node path:" << currentNodePath.path();
+                return {};
+            }
+            break;
         }
 
-        // Validate member name
-        if (!ConfigNodePath::validateNodeName(memberName))
+        case QJsonValue::Null:
+        case QJsonValue::Undefined:
+        {
+            // No overrides for the object derived from bases
+            break;
+        }
+
+        default:
         {
             qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << QString("Invalid member name [%1] in path [%2]")
-                       .arg(memberName, currentNodePath.path());
+                    << "Unsupported JSON type for the 'config' member at path:"
+                    << currentNodePath.path();
             return {};
         }
+    }
 
-        // Create a node based considering the decorator
-        std::unique_ptr<ConfigNode> memberNode;
-        const ConfigNodePath memberNodePath = currentNodePath.append(memberName);
-
-        switch (decorator.toLatin1())
-        {
-            case '#':
-            {
-                // Explicit Value node (even if it is a JSON Object type)
-                memberNode = readValueNode(it.value(), memberNodePath);
-                Q_ASSERT(memberNode != nullptr);
-                break;
-            }
+    // Create derived object node
+    return std::make_unique<ConfigDerivedObjectNode>(bases, *config);
+}
 
-            case '$':
-            {
-                // Explicit Value node (even if it is a JSON Array or Object type) where references
-                // to environment variables in the value are resolved
-                const QJsonValue resolvedValue = resolveJsonValue(it.value(), environmentVariables);
+// -------------------------------------------------------------------------------------------------
 
-                if (resolvedValue.isUndefined())
-                {
-                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                            << "Failed to resolve a Value node with references to "
-                               "environment variables:"
-                               "\n    member node path:" << memberNodePath.path();
-                    return {};
-                }
+std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
+        JsonStreamReader *reader,
+        const ConfigNodePath &currentNodePath,
+        const EnvironmentVariables &environmentVariables) const
+{
+    if (!reader->beginObject())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Failed to read a DerivedObject node at path [%1] (offset: %2): %3")
+                   .arg(currentNodePath.path())
+                   .arg(reader->errorOffset())
+                   .arg(reader->errorString());
+        return {};
+    }
 
-                memberNode = readValueNode(resolvedValue, memberNodePath);
-                Q_ASSERT(memberNode != nullptr);
-                break;
-            }
+    // The 'base' and 'config' members can be in any order so the bases are checked after all of the
+    // members are read
+    QJsonValue baseValue(QJsonValue::Undefined);
+    auto config = std::make_unique<ConfigObjectNode>();
+    QString memberName;
 
-            case '&':
+    while (reader->nextMember(&memberName))
+    {
+        if (memberName == QLatin1String("base"))
+        {
+            baseValue = reader->readValue();
+        }
+        else if (memberName == QLatin1String("config"))
+        {
+            switch (reader->peekType())
             {
-                // One of the reference types
-                if (it.value().isString())
+                case QJsonValue::Object:
                 {
-                    memberNode = readNodeReferenceNode(it.value().toString(), memberNodePath);
+                    // Read overrides for the object derived from bases
+                    config = readObjectNode(reader, currentNodePath, environmentVariables);
 
-                    if (!memberNode)
+                    if (!config)
                     {
                         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << "Failed to read the a NodeReference node member:"
-                                   "\n    member node path:" << memberNodePath.path();
+                                << "Failed to read the overrides for the object derived from "
+                                   "bases at path:"
+                                   "\n    node path:" << currentNodePath.path();
                         return {};
                     }
+                    break;
                 }
-                else if (it.value().isObject())
-                {
-                    memberNode = readDerivedObjectNode(it.value().toObject(),
-                                                       memberNodePath,
-                                                       environmentVariables);
 
-                    if (!memberNode)
-                    {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << "Failed to read the a NodeReference node member:"
-                                   "\n    member node path:" << memberNodePath.path();
-                        return {};
-                    }
-                }
-                else
+                case QJsonValue::Null:
                 {
-                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                            << "Unsupported reference type at path:" << memberNodePath.path();
-                    return {};
+                    // No overrides for the object derived from bases
+                    config = std::make_unique<ConfigObjectNode>();
+                    reader->skipValue();
+                    break;
                 }
-                break;
-            }
 
-            default:
-            {
-                // No decorators, just an ordinary node
-                if (it.value().isObject())
+                default:
                 {
-                    memberNode = readObjectNode(it.value().toObject(),
-                                                memberNodePath,
-                                                environmentVariables);
-
-                    if (!memberNode)
+                    if (!reader->hasError())
                     {
                         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << "Failed to read the an ordinary Object node member:"
-                                   "\n    member node path:" << memberNodePath.path();
+                                << "Unsupported JSON type for the 'config' member at path:"
+                                << currentNodePath.path();
                         return {};
                     }
+                    break;
                 }
-                else
-                {
-                    memberNode = readValueNode(it.value(), memberNodePath);
-                    Q_ASSERT(memberNode != nullptr);
-                }
-                break;
             }
         }
-
-        // Add member to the object
-        Q_ASSERT(memberNode != nullptr);
-        objectNode->setMember(memberName, std::move(memberNode));
+        else
+        {
+            reader->skipValue();
+        }
     }
 
-    return objectNode;
-}
-
-// -------------------------------------------------------------------------------------------------
+    if (reader->hasError())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Failed to read a DerivedObject node at path [%1] (offset: %2): %3")
+                   .arg(currentNodePath.path())
+                   .arg(reader->errorOffset())
+                   .arg(reader->errorString());
+        return {};
+    }
 
-std::unique_ptr<ConfigNodeReference> ConfigReader::readNodeReferenceNode(
-        const QString &reference, const ConfigNodePath &currentNodePath)
-{
-    const ConfigNodePath referencePath(reference);
+    // Extract bases
+    QList<ConfigNodePath> bases;
 
-    if (!referencePath.toAbsolute(currentNodePath).isValid())
+    if (!readDerivedObjectBases(baseValue, currentNodePath, &bases))
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << QString("Invalid node reference [%1] with current path [%2]")
-                   .arg(reference, currentNodePath.path());
         return {};
     }
 
-    return std::make_unique<ConfigNodeReference>(referencePath);
+    // Create derived object node
+    return std::make_unique<ConfigDerivedObjectNode>(bases, *config);
 }
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
-        const QJsonObject &jsonObject,
-        const ConfigNodePath &currentNodePath,
-        const EnvironmentVariables &environmentVariables)
+bool ConfigReader::readDerivedObjectBases(const QJsonValue &baseValue,
+                                          const ConfigNodePath &currentNodePath,
+                                          QList<ConfigNodePath> *bases)
 {
-    // Extract bases
-    const auto baseValue = jsonObject.value(QStringLiteral("base"));
-
     if (baseValue.isUndefined())
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "A derived object doesn't have the 'base' member at path:"
                 << currentNodePath.path();
-        return {};
+        return false;
     }
 
-    QList<ConfigNodePath> bases;
+    bases->clear();
 
     if (baseValue.isString())
     {
         // Single base
-        bases.append(ConfigNodePath(baseValue.toString()));
+        bases->append(ConfigNodePath(baseValue.toString()));
     }
     else if (baseValue.isArray())
     {
@@ -719,17 +2158,17 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
                 qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                         << "Unsupported JSON type for an item in the 'base' member at path:"
                         << currentNodePath.path();
-                return {};
+                return false;
             }
 
-            bases.append(ConfigNodePath(item.toString()));
+            bases->append(ConfigNodePath(item.toString()));
         }
 
-        if (bases.isEmpty())
+        if (bases->isEmpty())
         {
             qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                     << "The 'base' member is empty at path:" << currentNodePath.path();
-            return {};
+            return false;
         }
     }
     else
@@ -737,10 +2176,10 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Unsupported JSON type for an item in the 'base' member at path:"
                 << currentNodePath.path();
-        return {};
+        return false;
     }
 
-    for (const auto &item : bases)
+    for (const auto &item : *bases)
     {
         if (!item.toAbsolute(currentNodePath).isValid())
         {
@@ -749,49 +2188,11 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
                                "\n    base item's node path: %1"
                                "\n    node path: %2")
                        .arg(item.path(), currentNodePath.path());
-            return {};
-        }
-    }
-
-    // Extract config
-    auto config = std::make_unique<ConfigObjectNode>();
-    const auto configValue = jsonObject.value(QStringLiteral("config"));
-
-    switch (configValue.type())
-    {
-        case QJsonValue::Object:
-        {
-            // Read overrides for the object derived from bases
-            config = readObjectNode(configValue.toObject(), currentNodePath, environmentVariables);
-
-            if (!config)
-            {
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                        << "Failed to read the overrides for the object derived from bases at path:"
-                           "\n    node path:" << currentNodePath.path();
-                return {};
-            }
-            break;
-        }
-
-        case QJsonValue::Null:
-        case QJsonValue::Undefined:
-        {
-            // No overrides for the object derived from bases
-            break;
-        }
-
-        default:
-        {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << "Unsupported JSON type for the 'config' member at path:"
-                    << currentNodePath.path();
-            return {};
+            return false;
         }
     }
 
-    // Create derived object node
-    return std::make_unique<ConfigDerivedObjectNode>(bases, *config);
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -934,6 +2335,268 @@ bool ConfigReader::hasDecorator(const QString &memberName)
 
 // -------------------------------------------------------------------------------------------------
 
+int ConfigReader::countNodes(const ConfigNode &node)
+{
+    switch (node.type())
+    {
+        case ConfigNode::Type::Object:
+        {
+            const auto &objectNode = node.toObject();
+            int count = 1;
+
+            for (const auto &name : objectNode.names())
+            {
+                count += countNodes(*objectNode.member(name));
+            }
+
+            return count;
+        }
+
+        case ConfigNode::Type::DerivedObject:
+        {
+            // The overrides are stored in an Object node which is not counted as a separate node
+            return countNodes(node.toDerivedObject().config());
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return 1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReader::MemberSelection ConfigReader::selectMember(
+        const ConfigNodePath &memberNodePath,
+        const std::vector<ConfigNodePath> *selectedNodePaths)
+{
+    if (selectedNodePaths == nullptr)
+    {
+        return MemberSelection::All;
+    }
+
+    const QStringList &memberNodeNames = memberNodePath.nodeNames();
+    MemberSelection selection = MemberSelection::None;
+
+    for (const auto &selectedNodePath : *selectedNodePaths)
+    {
+        const QStringList &selectedNodeNames = selectedNodePath.nodeNames();
+        const int commonCount = std::min(memberNodeNames.size(), selectedNodeNames.size());
+
+        if (!std::equal(memberNodeNames.begin(),
+                        memberNodeNames.begin() + commonCount,
+                        selectedNodeNames.begin()))
+        {
+            continue;
+        }
+
+        if (memberNodeNames.size() >= selectedNodeNames.size())
+        {
+            // Member is in the subtree of a selected node
+            return MemberSelection::All;
+        }
+
+        // Member is on the path to a selected node
+        selection = MemberSelection::Path;
+    }
+
+    return selection;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::extendNodeSelection(const ConfigObjectNode &config,
+                                       std::vector<ConfigNodePath> *selectedNodePaths)
+{
+    std::vector<ConfigNodePath> referencedNodePaths;
+
+    if (!collectReferencedNodePaths(config, ConfigNodePath::ROOT_PATH, &referencedNodePaths))
+    {
+        // Read the whole configuration
+        selectedNodePaths->clear();
+        return true;
+    }
+
+    bool selectionChanged = false;
+
+    for (const auto &referencedNodePath : referencedNodePaths)
+    {
+        if (selectMember(referencedNodePath, selectedNodePaths) != MemberSelection::All)
+        {
+            selectedNodePaths->push_back(referencedNodePath);
+            selectionChanged = true;
+        }
+    }
+
+    return selectionChanged;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::collectReferencedNodePaths(const ConfigNode &node,
+                                              const ConfigNodePath &nodePath,
+                                              std::vector<ConfigNodePath> *referencedNodePaths)
+{
+    // References are resolved relative to the parent of the referencing node
+    const ConfigNodePath parentNodePath = nodePath.append(ConfigNodePath::PARENT_PATH);
+
+    switch (node.type())
+    {
+        case ConfigNode::Type::Object:
+        {
+            const auto &objectNode = node.toObject();
+
+            if (objectNode.unresolvedCount() == 0)
+            {
+                // There are no references in the subtree
+                return true;
+            }
+
+            for (const auto &name : objectNode.names())
+            {
+                if (!collectReferencedNodePaths(*objectNode.member(name),
+                                                nodePath.append(name),
+                                                referencedNodePaths))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        case ConfigNode::Type::NodeReference:
+        {
+            const auto referencedNodePath =
+                    normalizeReferencedNodePath(node.toNodeReference().reference(),
+                                                parentNodePath);
+
+            if (!referencedNodePath.isValid())
+            {
+                return false;
+            }
+
+            referencedNodePaths->push_back(referencedNodePath);
+            return true;
+        }
+
+        case ConfigNode::Type::DerivedObject:
+        {
+            const auto &derivedObjectNode = node.toDerivedObject();
+
+            for (const auto &base : derivedObjectNode.bases())
+            {
+                const auto referencedNodePath = normalizeReferencedNodePath(base, parentNodePath);
+
+                if (!referencedNodePath.isValid())
+                {
+                    return false;
+                }
+
+                referencedNodePaths->push_back(referencedNodePath);
+            }
+
+            // The overrides are resolved at the location of the DerivedObject node
+            const auto &overrides = derivedObjectNode.config();
+
+            for (const auto &name : overrides.names())
+            {
+                if (!collectReferencedNodePaths(*overrides.member(name),
+                                                nodePath.append(name),
+                                                referencedNodePaths))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodePath ConfigReader::normalizeReferencedNodePath(const ConfigNodePath &referenceNodePath,
+                                                         const ConfigNodePath &parentNodePath)
+{
+    if (referenceNodePath.hasUnresolvedReferences())
+    {
+        return {};
+    }
+
+    const ConfigNodePath absoluteNodePath = referenceNodePath.toAbsolute(parentNodePath);
+
+    if (!absoluteNodePath.isValid())
+    {
+        return {};
+    }
+
+    // Remove the parent node references
+    QStringList nodeNames;
+
+    for (const QString &nodeName : absoluteNodePath.nodeNames())
+    {
+        if (nodeName == ConfigNodePath::PARENT_PATH_VALUE)
+        {
+            if (nodeNames.isEmpty())
+            {
+                // Parent of the root node
+                return {};
+            }
+
+            nodeNames.removeLast();
+        }
+        else
+        {
+            nodeNames.append(nodeName);
+        }
+    }
+
+    ConfigNodePath normalizedNodePath(ConfigNodePath::ROOT_PATH);
+
+    for (const QString &nodeName : nodeNames)
+    {
+        normalizedNodePath.append(nodeName);
+    }
+
+    return normalizedNodePath;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigReader::makeAbsoluteFilePath(const QString &filePath,
+                                           const QDir &workingDir,
+                                           const EnvironmentVariables &environmentVariables)
+{
+    // Expand references to environment variables in the file path
+    const QString expandedFilePath = environmentVariables.expandText(filePath);
+
+    if (expandedFilePath.isEmpty())
+    {
+        return {};
+    }
+
+    // Prepare absolute path to the file using the working path if needed
+    if (QDir::isAbsolutePath(expandedFilePath))
+    {
+        return QDir::cleanPath(expandedFilePath);
+    }
+
+    return QDir::cleanPath(workingDir.absoluteFilePath(expandedFilePath));
+}
+
+// -------------------------------------------------------------------------------------------------
+
 void ConfigReader::setCurrentDirectory(const QDir &currentDir,
                                        EnvironmentVariables *environmentVariables)
 {
@@ -23,14 +23,19 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeIndex.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigTracer.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
+#include <QtCore/QVector>
 
 // System includes
+#include <algorithm>
+#include <unordered_set>
 
 // Forward declarations
 
@@ -41,441 +46,793 @@
 namespace CppConfigFramework
 {
 
-uint32_t ConfigReaderBase::referenceResolutionMaxCycles() const
+//! Resolves the references of a configuration node in the order of their dependencies
+class ConfigReaderBase::ReferenceResolver
 {
-    return m_referenceResolutionMaxCycles;
-}
+public:
+    /*!
+     * Constructor
+     *
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     * \param   statistics          Optional output for the read statistics
+     * \param   externalNodeLookups Optional output for the lookups in the external configuration
+     *                              nodes
+     */
+    ReferenceResolver(const std::vector<const ConfigObjectNode *> &externalConfigs,
+                      ReadStatistics *statistics,
+                      std::vector<ExternalNodeLookup> *externalNodeLookups);
+
+    /*!
+     * Resolves all references in the specified Object node
+     *
+     * \param[in,out]   node    Configuration node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * The dependencies are tracked with an explicit stack of tasks instead of recursion so that
+     * long reference chains and deeply nested configuration nodes can be resolved.
+     */
+    bool resolveObject(ConfigObjectNode *node);
+
+private:
+    //! Result of an attempt to resolve a node
+    enum class Status
+    {
+        Failed,     //!< Node could not be resolved
+        Pending,    //!< Node depends on nodes that need to be resolved first (tasks were added)
+        Resolved    //!< Node was resolved
+    };
+
+    //! Pending work of the resolver
+    struct Task
+    {
+        //! Task types
+        enum class Type
+        {
+            ResolveObject,  //!< Resolve all of the members of an Object node
+            ResolveMember   //!< Resolve a NodeReference or DerivedObject member
+        };
+
+        //! Task type
+        Type type;
+
+        //! Object node to resolve or the parent of the member to resolve
+        ConfigObjectNode *node;
+
+        //! Reference node to resolve (only for ResolveMember tasks)
+        const ConfigNode *referenceNode;
+
+        //! Name of the member to resolve (only for ResolveMember tasks)
+        QString name;
+
+        //! Names of the members of the Object node (only for ResolveObject tasks)
+        QStringList names;
+
+        //! Index of the next member of the Object node to check (only for ResolveObject tasks)
+        int position;
+    };
+
+    /*!
+     * Adds a task for resolving all of the members of the Object node
+     *
+     * \param   node    Object node
+     */
+    void pushObjectTask(ConfigObjectNode *node);
+
+    /*!
+     * Adds a task for resolving the member (NodeReference or DerivedObject node) of the parent node
+     *
+     * \param   name    Name of the member
+     *
+     * \param[in,out]   parentNode  Parent configuration node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure, the member is already being resolved (reference cycle)
+     */
+    bool pushMemberTask(const QString &name, ConfigObjectNode *parentNode);
+
+    /*!
+     * Continues with the ResolveObject task at the top of the stack
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * The task is removed from the stack once all of the members of its node are resolved. A
+     * member that needs to be resolved first adds its own task and the iteration is resumed from
+     * the same member once that task is done.
+     */
+    bool processObjectTask();
+
+    /*!
+     * Continues with the ResolveMember task at the top of the stack
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * The task is removed from the stack once the reference node is replaced with the resolved
+     * node. In case the referenced nodes are not resolved yet the tasks for them are added and the
+     * resolution is retried once they are done.
+     */
+    bool processMemberTask();
+
+    /*!
+     * Creates the configuration node that replaces the NodeReference node
+     *
+     * \param   node    NodeReference node
+     *
+     * \param[in,out]   parentNode      Parent configuration node
+     * \param[out]      resolvedNode    Resolved configuration node
+     *
+     * \return  Status of the resolution
+     */
+    Status resolveNodeReference(const ConfigNodeReference &node,
+                                ConfigObjectNode *parentNode,
+                                std::unique_ptr<ConfigNode> *resolvedNode);
+
+    /*!
+     * Creates the configuration node that replaces the DerivedObject node
+     *
+     * \param   node    DerivedObject node
+     *
+     * \param[in,out]   parentNode      Parent configuration node
+     * \param[out]      resolvedNode    Resolved configuration node
+     *
+     * \return  Status of the resolution
+     */
+    Status resolveDerivedObject(const ConfigDerivedObjectNode &node,
+                                ConfigObjectNode *parentNode,
+                                std::unique_ptr<ConfigNode> *resolvedNode);
+
+    /*!
+     * Finds the referenced configuration node in the configuration node that is being resolved
+     *
+     * \param   referenceNodePath   Reference to the configuration node
+     *
+     * \param[in,out]   parentNode      Parent configuration node of the referencing node
+     * \param[out]      referencedNode  Referenced configuration node or null in case the node was
+     *                                  not found
+     *
+     * \retval  Status::Failed      A reference that needs to be resolved first is part of a
+     *                              reference cycle
+     * \retval  Status::Pending     The node path or the node itself contains references that need
+     *                              to be resolved first
+     * \retval  Status::Resolved    Fully resolved node was found or the node does not exist
+     */
+    Status findInternalNode(const ConfigNodePath &referenceNodePath,
+                            ConfigObjectNode *parentNode,
+                            const ConfigNode **referencedNode);
+
+    /*!
+     * Finds the referenced configuration node in the configuration nodes provided by an external
+     * source
+     *
+     * \param   referenceNodePath   Reference to the configuration node
+     * \param   parentNode          Parent configuration node of the referencing node
+     *
+     * \param[out]  referencedNode  Configuration node from the last external configuration node
+     *                              where it was found or null if it was not found
+     *
+     * \retval  true    Success
+     * \retval  false   Failure, the found node is not fully resolved
+     *
+     * This is only done for the nodes that were not found in the configuration node that is being
+     * resolved.
+     */
+    bool findExternalNode(const ConfigNodePath &referenceNodePath,
+                          const ConfigObjectNode &parentNode,
+                          const ConfigNode **referencedNode);
+
+private:
+    //! Configuration nodes provided by an external source
+    const std::vector<const ConfigObjectNode *> &m_externalConfigs;
+
+    //! Indexes of the configuration nodes provided by an external source
+    std::vector<ConfigNodeIndex> m_externalConfigIndexes;
+
+    //! Optional output for the read statistics
+    ReadStatistics *m_statistics;
+
+    //! Optional output for the lookups in the external configuration nodes
+    std::vector<ExternalNodeLookup> *m_externalNodeLookups;
+
+    //! Stack of the pending tasks (the task at the top is processed first)
+    std::vector<Task> m_tasks;
+
+    //! Reference nodes with a pending task (used for detection of reference cycles)
+    std::unordered_set<const ConfigNode *> m_pendingReferenceNodes;
+};
 
 // -------------------------------------------------------------------------------------------------
 
-void ConfigReaderBase::setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles)
+ConfigReaderBase::ReferenceResolver::ReferenceResolver(
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        ReadStatistics *statistics,
+        std::vector<ExternalNodeLookup> *externalNodeLookups)
+    : m_externalConfigs(externalConfigs),
+      m_statistics(statistics),
+      m_externalNodeLookups(externalNodeLookups)
 {
-    m_referenceResolutionMaxCycles = referenceResolutionMaxCycles;
+    // The external configuration nodes are not modified during the resolution so the nodes found
+    // in them can be indexed
+    m_externalConfigIndexes.reserve(m_externalConfigs.size());
+
+    for (const auto *externalConfig : m_externalConfigs)
+    {
+        m_externalConfigIndexes.emplace_back(*externalConfig);
+    }
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigReaderBase::isFullyResolved(const ConfigNode &node)
+bool ConfigReaderBase::ReferenceResolver::resolveObject(ConfigObjectNode *node)
 {
-    switch (node.type())
+    // Check if the node is already fully resolved
+    if (node->unresolvedCount() == 0)
     {
-        case ConfigNode::Type::Value:
-        {
-            return true;
-        }
+        return true;
+    }
 
-        case ConfigNode::Type::Object:
-        {
-            const auto &objectNode = node.toObject();
+    // Process the tasks until all of the dependencies are resolved
+    pushObjectTask(node);
 
-            for (const auto &name : objectNode.names())
-            {
-                if (!isFullyResolved(*objectNode.member(name)))
-                {
-                    return false;
-                }
-            }
-
-            return true;
-        }
+    while (!m_tasks.empty())
+    {
+        const bool success = (m_tasks.back().type == Task::Type::ResolveObject)
+                             ? processObjectTask()
+                             : processMemberTask();
 
-        default:
+        if (!success)
         {
-            break;
+            m_tasks.clear();
+            m_pendingReferenceNodes.clear();
+            return false;
         }
     }
 
-    return false;
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-QStringList ConfigReaderBase::unresolvedReferences(const ConfigObjectNode &node)
+void ConfigReaderBase::ReferenceResolver::pushObjectTask(ConfigObjectNode *node)
 {
-    QStringList references;
+    m_tasks.push_back({ Task::Type::ResolveObject, node, nullptr, {}, node->names(), 0 });
+}
 
-    // Iterate over all members and add all nodes of a reference type to the list
-    for (const QString &name : node.names())
-    {
-        const auto *member = node.member(name);
+// -------------------------------------------------------------------------------------------------
 
-        if (member->isNodeReference() || member->isDerivedObject())
-        {
-            references.append(member->nodePath().path());
-        }
-        else if (member->isObject())
-        {
-            references.append(unresolvedReferences(member->toObject()));
-        }
-        else
+bool ConfigReaderBase::ReferenceResolver::pushMemberTask(const QString &name,
+                                                         ConfigObjectNode *parentNode)
+{
+    const auto *node = parentNode->member(name);
+    Q_ASSERT(node != nullptr);
+    Q_ASSERT(node->isNodeReference() || node->isDerivedObject());
+
+    // Check for a reference cycle (the node depends on itself)
+    if (m_pendingReferenceNodes.count(node) > 0)
+    {
+        const auto it = std::find_if(m_tasks.begin(),
+                                     m_tasks.end(),
+                                     [node](const Task &task)
+                                     {
+                                         return (task.referenceNode == node);
+                                     });
+        QStringList cycle;
+
+        for (auto cycleIt = it; cycleIt != m_tasks.end(); cycleIt++)
         {
-            // No unresolved references
+            if (cycleIt->type == Task::Type::ResolveMember)
+            {
+                cycle.append(cycleIt->referenceNode->nodePath().path());
+            }
         }
+
+        cycle.append(node->nodePath().path());
+
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Reference cycle detected: [%1]").arg(cycle.join(" -> "));
+        return false;
     }
 
-    return references;
+    m_tasks.push_back({ Task::Type::ResolveMember, parentNode, node, name, {}, 0 });
+    m_pendingReferenceNodes.insert(node);
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigReaderBase::resolveReferences(
-        const std::vector<const ConfigObjectNode *> &externalConfigs,
-        ConfigObjectNode *config) const
+bool ConfigReaderBase::ReferenceResolver::processObjectTask()
 {
-    auto result = ReferenceResolutionResult::Unchanged;
-    uint32_t resolutionCycle;
+    // Adding tasks can reallocate the stack so the task is accessed through its index
+    const size_t taskIndex = m_tasks.size() - 1U;
+    auto *node = m_tasks[taskIndex].node;
 
-    for (resolutionCycle = 0;
-         (resolutionCycle < m_referenceResolutionMaxCycles) &&
-         (result != ReferenceResolutionResult::Resolved);
-         resolutionCycle++)
+    // Iterate over the remaining members and resolve their references
+    while ((node->unresolvedCount() > 0) &&
+           (m_tasks[taskIndex].position < m_tasks[taskIndex].names.size()))
     {
-        // Try to resolve references without external configuration nodes
-        auto newResult = resolveObjectReferences({}, config);
+        const QString name = m_tasks[taskIndex].names.at(m_tasks[taskIndex].position);
+        auto *member = node->member(name);
 
-        switch (newResult)
+        switch (member->type())
         {
-            case ReferenceResolutionResult::Resolved:
-            case ReferenceResolutionResult::PartiallyResolved:
+            case ConfigNode::Type::Value:
             {
-                result = newResult;
+                // Not a reference type
                 break;
             }
 
-            case ReferenceResolutionResult::Unchanged:
+            case ConfigNode::Type::Object:
             {
-                // Check if external configuration nodes are provided
-                if (externalConfigs.empty())
+                if (member->toObject().unresolvedCount() > 0)
                 {
-                    result = ReferenceResolutionResult::Unchanged;
-                    break;
-                }
-
-                // External configuration nodes are provided, try to resolve references with them
-                newResult = resolveObjectReferences(externalConfigs, config);
-
-                switch (newResult)
-                {
-                    case ReferenceResolutionResult::Resolved:
-                    case ReferenceResolutionResult::PartiallyResolved:
-                    {
-                        result = newResult;
-                        break;
-                    }
-
-                    case ReferenceResolutionResult::Unchanged:
-                    {
-                        // Still unchanged
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << QString("No references were resolved in the last cycle even "
-                                           "after using the external configuration nodes:"
-                                           "\n    cycle no.: %1"
-                                           "\n    unresolved references: [%2]")
-                                   .arg(resolutionCycle)
-                                   .arg(unresolvedReferences(*config).join("; "));
-                        return false;
-                    }
-
-                    case ReferenceResolutionResult::Error:
-                    {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << QString("Failed to resolve references when using the external "
-                                           "configuration nodes:"
-                                           "\n    cycle no.: %1"
-                                           "\n    unresolved references: [%2]")
-                                   .arg(resolutionCycle)
-                                   .arg(unresolvedReferences(*config).join("; "));
-                        return false;
-                    }
+                    pushObjectTask(&member->toObject());
+                    return true;
                 }
                 break;
             }
 
-            case ReferenceResolutionResult::Error:
+            case ConfigNode::Type::NodeReference:
+            case ConfigNode::Type::DerivedObject:
             {
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                        << QString("Failed to resolve references:"
-                                   "\n    cycle no.: %1"
-                                   "\n    unresolved references: [%2]")
-                           .arg(resolutionCycle)
-                           .arg(unresolvedReferences(*config).join("; "));
-                return false;
+                return pushMemberTask(name, node);
             }
         }
+
+        m_tasks[taskIndex].position++;
     }
 
-    if (result != ReferenceResolutionResult::Resolved)
+    m_tasks.pop_back();
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderBase::ReferenceResolver::processMemberTask()
+{
+    // Adding tasks can reallocate the stack so the task is copied
+    const Task task = m_tasks.back();
+    const bool isDerivedObject = task.referenceNode->isDerivedObject();
+
+    // Create the node that shall replace the reference node
+    std::unique_ptr<ConfigNode> resolvedNode;
+    Status status = Status::Failed;
+
+    if (isDerivedObject)
+    {
+        status = resolveDerivedObject(task.referenceNode->toDerivedObject(),
+                                      task.node,
+                                      &resolvedNode);
+    }
+    else
+    {
+        status = resolveNodeReference(task.referenceNode->toNodeReference(),
+                                      task.node,
+                                      &resolvedNode);
+    }
+
+    switch (status)
+    {
+        case Status::Failed:
+        {
+            return false;
+        }
+
+        case Status::Pending:
+        {
+            // Retry once the dependencies are resolved
+            return true;
+        }
+
+        case Status::Resolved:
+        {
+            break;
+        }
+    }
+
+    // The reference node must be removed from the stack before it gets replaced (destroyed)
+    m_tasks.pop_back();
+    m_pendingReferenceNodes.erase(task.referenceNode);
+
+    // Replace the reference node with the resolved node
+    if (!task.node->setMember(task.name, std::move(resolvedNode)))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << QString("Failed to fully resolve references:"
-                           "\n    cycle no.: %1"
-                           "\n    unresolved references: [%2]")
-                   .arg(resolutionCycle)
-                   .arg(unresolvedReferences(*config).join("; "));
+                << QString("Failed to store the resolved node [%1] to the parent object at node "
+                           "path [%2]")
+                   .arg(task.name, task.node->nodePath().path());
         return false;
     }
 
+    // The overrides of a DerivedObject node can contain references of their own which need to be
+    // resolved at their new location
+    if (isDerivedObject)
+    {
+        auto *derivedObjectNode = &task.node->member(task.name)->toObject();
+
+        if (derivedObjectNode->unresolvedCount() > 0)
+        {
+            pushObjectTask(derivedObjectNode);
+        }
+    }
+
     return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveObjectReferences(
-        const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigObjectNode *node)
+ConfigReaderBase::ReferenceResolver::Status
+ConfigReaderBase::ReferenceResolver::resolveNodeReference(
+        const ConfigNodeReference &node,
+        ConfigObjectNode *parentNode,
+        std::unique_ptr<ConfigNode> *resolvedNode)
 {
-    // Iterate over all members and try to resolve their references
-    auto result = ReferenceResolutionResult::Unchanged;
+    const ConfigNode *referencedNode = nullptr;
+    const Status status = findInternalNode(node.reference(), parentNode, &referencedNode);
 
-    for (const QString &name : node->names())
+    if (status != Status::Resolved)
     {
-        // Try to resolve the member's references
-        auto *member = node->member(name);
+        return status;
+    }
 
-        switch (member->type())
-        {
-            case ConfigNode::Type::Value:
-            {
-                // Not a reference type, leave the result as is
-                break;
-            }
+    if ((referencedNode == nullptr) &&
+        (!findExternalNode(node.reference(), *parentNode, &referencedNode)))
+    {
+        return Status::Failed;
+    }
 
-            case ConfigNode::Type::Object:
-            {
-                // Try to resolve the member's (Object node) references
-                auto newResult = resolveObjectReferences(externalConfigs, &member->toObject());
+    if (referencedNode == nullptr)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Failed to find the node [%1] referenced by the NodeReference node "
+                           "[%2]")
+                   .arg(node.reference().path(), node.nodePath().path());
+        return Status::Failed;
+    }
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+    if (m_statistics != nullptr)
+    {
+        m_statistics->clonesPerformed++;
+    }
 
-            case ConfigNode::Type::NodeReference:
-            {
-                // Try to resolve the member's (NodeReference node) reference
-                auto newResult = resolveNodeReference(externalConfigs, &member->toNodeReference());
+    *resolvedNode = referencedNode->clone();
+    return Status::Resolved;
+}
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+// -------------------------------------------------------------------------------------------------
 
-            case ConfigNode::Type::DerivedObject:
-            {
-                // Try to resolve the member's (DerivedObject node) references
-                auto newResult = resolveDerivedObjectReferences(externalConfigs,
-                                                                &member->toDerivedObject());
+ConfigReaderBase::ReferenceResolver::Status
+ConfigReaderBase::ReferenceResolver::resolveDerivedObject(
+        const ConfigDerivedObjectNode &node,
+        ConfigObjectNode *parentNode,
+        std::unique_ptr<ConfigNode> *resolvedNode)
+{
+    // Find all of the base nodes in the configuration node that is being resolved first so that
+    // the external configuration nodes are only searched once all of the dependencies are resolved
+    const auto &bases = node.bases();
+    QVector<const ConfigNode *> foundNodes(bases.size(), nullptr);
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+    for (int i = 0; i < bases.size(); i++)
+    {
+        const Status status = findInternalNode(bases.at(i), parentNode, &foundNodes[i]);
+
+        if (status != Status::Resolved)
+        {
+            return status;
+        }
+    }
+
+    std::vector<const ConfigObjectNode *> baseNodes;
+    baseNodes.reserve(bases.size() + 1);
+
+    for (int i = 0; i < bases.size(); i++)
+    {
+        const auto &baseNodePath = bases.at(i);
+        const ConfigNode *baseNode = foundNodes.at(i);
+
+        if ((baseNode == nullptr) && (!findExternalNode(baseNodePath, *parentNode, &baseNode)))
+        {
+            return Status::Failed;
         }
 
-        // Stop on error
-        if (result == ReferenceResolutionResult::Error)
+        if (baseNode == nullptr)
         {
-            return ReferenceResolutionResult::Error;
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Failed to find the base node [%1] of the DerivedObject node [%2]")
+                       .arg(baseNodePath.path(), node.nodePath().path());
+            return Status::Failed;
         }
+
+        // Check if the node is an object
+        if (!baseNode->isObject())
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Base node [%1] in a DerivedObject node [%2] is referencing a "
+                               "node that is not an Object node!")
+                       .arg(baseNodePath.path(), node.nodePath().path());
+            return Status::Failed;
+        }
+
+        baseNodes.push_back(&baseNode->toObject());
     }
 
-    // Check if the object is fully resolved
-    if (isFullyResolved(*node))
+    ConfigTraceSpan traceSpan(QStringLiteral("resolver"), QStringLiteral("Derived object"));
+
+    if (traceSpan.isActive())
     {
-        return ReferenceResolutionResult::Resolved;
+        const QString nodePath = node.nodePath().path();
+        traceSpan.setName(QStringLiteral("Derived object: ") + nodePath);
+        traceSpan.setArgument(QStringLiteral("node_path"), nodePath);
     }
 
-    return result;
+    // All the bases are resolved so the derived object node can be layered from them in the listed
+    // order with the overrides on top (the layers are merged only where the derived object node is
+    // accessed, the rest of it is shared with the base nodes)
+    int appliedNodeCount = static_cast<int>(baseNodes.size());
+
+    if (node.config().count() > 0)
+    {
+        baseNodes.push_back(&node.config());
+        appliedNodeCount++;
+    }
+
+    *resolvedNode = ConfigObjectNode::createLayered(baseNodes);
+
+    if (m_statistics != nullptr)
+    {
+        m_statistics->clonesPerformed += appliedNodeCount;
+    }
+
+    return Status::Resolved;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::updateObjectResolutionResult(
-        const ConfigReaderBase::ReferenceResolutionResult currentResult,
-        const ConfigReaderBase::ReferenceResolutionResult newResult)
+ConfigReaderBase::ReferenceResolver::Status
+ConfigReaderBase::ReferenceResolver::findInternalNode(
+        const ConfigNodePath &referenceNodePath,
+        ConfigObjectNode *parentNode,
+        const ConfigNode **referencedNode)
 {
-    auto result = currentResult;
+    *referencedNode = nullptr;
 
-    switch (newResult)
+    if (!referenceNodePath.isValid())
     {
-        case ReferenceResolutionResult::Resolved:
+        return Status::Resolved;
+    }
+
+    // Walk the node path, all of the references on it must be resolved before continuing to the
+    // next node
+    ConfigNode *currentNode = (referenceNodePath.isAbsolute() ? parentNode->rootNode()
+                                                              : parentNode);
+    const auto &nodeNameList = referenceNodePath.nodeNames();
+
+    for (const QString &nodeName : nodeNameList)
+    {
+        // Check if parent node is referenced
+        if (nodeName == ConfigNodePath::PARENT_PATH_VALUE)
         {
-            if (result == ReferenceResolutionResult::Unchanged)
+            if (currentNode->isRoot())
             {
-                result = ReferenceResolutionResult::PartiallyResolved;
+                // Parent of the root node was requested
+                return Status::Resolved;
             }
-            break;
+
+            currentNode = currentNode->parent();
+            continue;
         }
 
-        case ReferenceResolutionResult::Unchanged:
+        // Get the specified member node
+        if (!currentNode->isObject())
         {
-            if (result == ReferenceResolutionResult::Resolved)
-            {
-                result = ReferenceResolutionResult::PartiallyResolved;
-            }
-            break;
+            return Status::Resolved;
         }
 
-        case ReferenceResolutionResult::PartiallyResolved:
+        auto *objectNode = &currentNode->toObject();
+        currentNode = objectNode->member(nodeName);
+
+        if (currentNode == nullptr)
         {
-            if ((result == ReferenceResolutionResult::Resolved) ||
-                (result == ReferenceResolutionResult::Unchanged))
-            {
-                result = ReferenceResolutionResult::PartiallyResolved;
-            }
-            break;
+            return Status::Resolved;
         }
 
-        case ReferenceResolutionResult::Error:
+        if (currentNode->isNodeReference() || currentNode->isDerivedObject())
         {
-            result = ReferenceResolutionResult::Error;
+            return (pushMemberTask(nodeName, objectNode) ? Status::Pending : Status::Failed);
         }
     }
 
-    return result;
+    // Node was found, make sure that it is fully resolved before it gets used
+    if (currentNode->isObject() && (currentNode->toObject().unresolvedCount() > 0))
+    {
+        pushObjectTask(&currentNode->toObject());
+        return Status::Pending;
+    }
+
+    *referencedNode = currentNode;
+    return Status::Resolved;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveNodeReference(
-        const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigNodeReference *node)
+bool ConfigReaderBase::ReferenceResolver::findExternalNode(
+        const ConfigNodePath &referenceNodePath,
+        const ConfigObjectNode &parentNode,
+        const ConfigNode **referencedNode)
 {
-    // Try to get the referenced node
-    auto *parentNode = node->parent();
-    const auto *referencedNode = findReferencedConfigNode(node->reference(),
-                                                          *parentNode,
-                                                          externalConfigs);
+    *referencedNode = nullptr;
 
-    if (referencedNode == nullptr)
+    if (!referenceNodePath.isValid())
     {
-        return ReferenceResolutionResult::Unchanged;
+        return true;
     }
 
-    auto result = (isFullyResolved(*referencedNode) ? ReferenceResolutionResult::Resolved
-                                                    : ReferenceResolutionResult::PartiallyResolved);
+    if (m_externalNodeLookups != nullptr)
+    {
+        m_externalNodeLookups->push_back({ referenceNodePath, parentNode.nodePath() });
+    }
+
+    // Use the last found node
+    const ConfigNode *externalNode = nullptr;
+
+    for (auto it = m_externalConfigIndexes.rbegin(); it != m_externalConfigIndexes.rend(); it++)
+    {
+        externalNode = it->find(referenceNodePath, parentNode.nodePath());
+
+        if (externalNode != nullptr)
+        {
+            break;
+        }
+    }
 
-    // Replace the current node with the referenced node
-    if (!parentNode->setMember(parentNode->name(*node), *referencedNode))
+    if ((externalNode != nullptr) && !isFullyResolved(*externalNode))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << QString("Failed to store the resolved NodeReference node [%1] to the parent "
-                           "object at node path [%2]")
-                   .arg(node->reference().path(), parentNode->nodePath().path());
-        return ReferenceResolutionResult::Error;
+                << QString("Node [%1] referenced from node path [%2] was found in the external "
+                           "configuration nodes, but it is not fully resolved")
+                   .arg(referenceNodePath.path(), parentNode.nodePath().path());
+        return false;
     }
 
-    return result;
+    *referencedNode = externalNode;
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveDerivedObjectReferences(
-        const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigDerivedObjectNode *node)
+uint32_t ConfigReaderBase::referenceResolutionMaxCycles() const
 {
-    // Derive the config node from the all of the base nodes
-    auto *parentNode = node->parent();
-    std::vector<const ConfigObjectNode *> baseNodes;
-    baseNodes.reserve(node->bases().size());
+    return m_referenceResolutionMaxCycles;
+}
 
-    for (const auto &baseNodePath : node->bases())
-    {
-        // Try to find the base node
-        const auto *baseNode = findReferencedConfigNode(baseNodePath, *parentNode, externalConfigs);
+// -------------------------------------------------------------------------------------------------
 
-        if (baseNode == nullptr)
+void ConfigReaderBase::setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles)
+{
+    m_referenceResolutionMaxCycles = referenceResolutionMaxCycles;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderBase::isFullyResolved(const ConfigNode &node)
+{
+    switch (node.type())
+    {
+        case ConfigNode::Type::Value:
         {
-            return ReferenceResolutionResult::Unchanged;
+            return true;
         }
 
-        // Check if the base node is fully resolved
-        if (!isFullyResolved(*baseNode))
+        case ConfigNode::Type::Object:
         {
-            // Base node is not resolved (yet)
-            return ReferenceResolutionResult::Unchanged;
+            return (node.toObject().unresolvedCount() == 0);
         }
 
-        // Check if the node is an object
-        if (!baseNode->isObject())
+        default:
         {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << QString("Base node [%1] in a DerivedObject node [%2] is referencing a "
-                               "node that is not an Object node!")
-                       .arg(baseNodePath.path(), node->nodePath().path());
-            return ReferenceResolutionResult::Error;
+            break;
         }
-
-        // Store the base node to the temporary container
-        baseNodes.push_back(&baseNode->toObject());
     }
 
-    // All the bases are resolved so they can now be applied to an empty object in the listed order
-    // to create a derived object node
-    ConfigObjectNode derivedObjectNode(parentNode);
+    return false;
+}
 
-    for (const auto *baseNode : baseNodes)
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigReaderBase::unresolvedReferences(const ConfigObjectNode &node)
+{
+    QStringList references;
+
+    // Iterate over all members and add all nodes of a reference type to the list
+    for (const QString &name : node.names())
     {
-        derivedObjectNode.apply(*baseNode);
+        const auto *member = node.member(name);
+
+        if (member->isNodeReference() || member->isDerivedObject())
+        {
+            references.append(member->nodePath().path());
+        }
+        else if (member->isObject() && (member->toObject().unresolvedCount() > 0))
+        {
+            references.append(unresolvedReferences(member->toObject()));
+        }
+        else
+        {
+            // No unresolved references
+        }
     }
 
-    // Apply overrides to the derived object node
-    if (node->config().count() > 0)
+    return references;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderBase::resolveReferences(
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        ConfigObjectNode *config,
+        ReadStatistics *statistics,
+        std::vector<ExternalNodeLookup> *externalNodeLookups) const
+{
+    ConfigTraceSpan traceSpan(QStringLiteral("resolver"), QStringLiteral("Resolve references"));
+
+    if (statistics != nullptr)
     {
-        derivedObjectNode.apply(node->config());
+        // All references are resolved in a single pass, the max cycles limit is only reported
+        statistics->referenceResolutionMaxCycles = m_referenceResolutionMaxCycles;
+        statistics->referenceResolutionCycles++;
+        statistics->referenceResolutionMaxCyclesUsed =
+                std::max(statistics->referenceResolutionMaxCyclesUsed, 1U);
     }
 
-    auto result = (isFullyResolved(derivedObjectNode)
-                   ? ReferenceResolutionResult::Resolved
-                   : ReferenceResolutionResult::PartiallyResolved);
-
+    ReferenceResolver resolver(externalConfigs, statistics, externalNodeLookups);
 
-    // Replace the current node with the referenced node
-    if (!parentNode->setMember(parentNode->name(*node), derivedObjectNode))
+    if (!resolver.resolveObject(config))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << QString("Failed to store the resolved DerivedObject node [%1] to the parent "
-                           "object at node path [%2]")
-                   .arg(node->nodePath().path(), parentNode->nodePath().path());
-        return ReferenceResolutionResult::Error;
+                << QString("Failed to resolve references:"
+                           "\n    unresolved references: [%1]")
+                   .arg(unresolvedReferences(*config).join("; "));
+        return false;
     }
 
-    return result;
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-const ConfigNode *ConfigReaderBase::findReferencedConfigNode(
+const ConfigNode *ConfigReaderBase::findExternalConfigNode(
         const ConfigNodePath &referenceNodePath,
-        const ConfigObjectNode &parentNode,
+        const ConfigNodePath &parentNodePath,
         const std::vector<const ConfigObjectNode *> &externalConfigs)
 {
-    const auto *referencedNode = parentNode.nodeAtPath(referenceNodePath);
+    // Try to find the node in the external configuration nodes (use last found node)
+    const ConfigNode *referencedNode = nullptr;
 
-    if (referencedNode == nullptr)
+    for (const auto *externalConfig : externalConfigs)
     {
-        // Unable to find the node reference, try to find it in one of the external configuration
-        // nodes (use last found node)
-        for (const auto *externalConfig : externalConfigs)
+        if (referenceNodePath.isAbsolute())
         {
-            if (referenceNodePath.isAbsolute())
-            {
-                const auto *foundNode = externalConfig->nodeAtPath(referenceNodePath);
+            const auto *foundNode = externalConfig->nodeAtPath(referenceNodePath);
 
-                if (foundNode != nullptr)
-                {
-                    referencedNode = foundNode;
-                }
+            if (foundNode != nullptr)
+            {
+                referencedNode = foundNode;
             }
-            else
+        }
+        else
+        {
+            // First try to find the equivalent parent node from the external config and then try
+            // to get the node using the relative path
+            const auto *externalConfigParent = externalConfig->nodeAtPath(parentNodePath);
+
+            if (externalConfigParent != nullptr)
             {
-                // First try to find the equivalent parent node from the external config and then
-                // try to get the node using the relative path
-                const auto *externalConfigParent =
-                        externalConfig->nodeAtPath(parentNode.nodePath());
+                const auto *foundNode = externalConfigParent->nodeAtPath(referenceNodePath);
 
-                if (externalConfigParent != nullptr)
+                if (foundNode != nullptr)
                 {
-                    const auto *foundNode = externalConfigParent->nodeAtPath(referenceNodePath);
-
-                    if (foundNode != nullptr)
-                    {
-                        referencedNode = foundNode;
-                    }
+                    referencedNode = foundNode;
                 }
             }
         }
@@ -502,7 +859,8 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderBase::transformConfig(
         return config;
     }
 
-    // Take the source node
+    // Take the source node (it is detached from its parent instead of copied, the rest of the
+    // configuration is discarded)
     std::unique_ptr<ConfigNode> sourceConfig;
 
     if (sourceNodePath.isRoot())
@@ -511,7 +869,7 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderBase::transformConfig(
     }
     else
     {
-        const auto *node = config->nodeAtPath(sourceNodePath);
+        auto *node = config->nodeAtPath(sourceNodePath);
 
         if (node == nullptr)
         {
@@ -521,7 +879,18 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderBase::transformConfig(
             return {};
         }
 
-        sourceConfig = node->clone();
+        auto *parentNode = node->parent();
+
+        if (parentNode == nullptr)
+        {
+            // The node path points to the root node
+            sourceConfig = std::move(config);
+        }
+        else
+        {
+            sourceConfig = parentNode->take(parentNode->name(*node));
+            Q_ASSERT(sourceConfig);
+        }
     }
 
     // For "root" destination just return the source node
@@ -534,13 +903,14 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderBase::transformConfig(
             return {};
         }
 
-        return std::make_unique<ConfigObjectNode>(std::move(sourceConfig->toObject()));
+        return std::unique_ptr<ConfigObjectNode>(
+                    static_cast<ConfigObjectNode *>(sourceConfig.release()));
     }
 
     // Create a new config node from the destination node path and set the source config node to it
     auto transformedConfig = std::make_unique<ConfigObjectNode>();
 
-    const QStringList nodeNames = destinationNodePath.nodeNames();
+    const QStringList &nodeNames = destinationNodePath.nodeNames();
     ConfigObjectNode *currentNode = transformedConfig.get();
 
     for (int i = 0; i < nodeNames.size(); i++)
@@ -62,6 +62,20 @@ bool ConfigReaderRegistry::registerConfigReader(const QString &type,
 
 // -------------------------------------------------------------------------------------------------
 
+const ConfigReaderBase *ConfigReaderRegistry::configReader(const QString &type) const
+{
+    auto it = m_configReaders.find(type);
+
+    if (it == m_configReaders.end())
+    {
+        return nullptr;
+    }
+
+    return it->second.get();
+}
+
+// -------------------------------------------------------------------------------------------------
+
 std::unique_ptr<ConfigObjectNode> ConfigReaderRegistry::readConfig(
         const QString &type,
         const QDir &workingDir,
@@ -71,23 +85,21 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderRegistry::readConfig(
         EnvironmentVariables *environmentVariables) const
 {
     // Get the specified type of config reader
-    auto it = m_configReaders.find(type);
+    const auto *reader = configReader(type);
 
-    if (it == m_configReaders.end())
+    if (reader == nullptr)
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Unsupported configuration type:" << type;
         return {};
     }
 
-    auto *configReader = it->second.get();
-
     // Read the config
-    return configReader->read(workingDir,
-                              destinationNodePath,
-                              otherParameters,
-                              externalConfigs,
-                              environmentVariables);
+    return reader->read(workingDir,
+                        destinationNodePath,
+                        otherParameters,
+                        externalConfigs,
+                        environmentVariables);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -0,0 +1,1194 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for the binary snapshots of resolved configurations
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigSnapshot.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+#include <QtCore/QtEndian>
+
+// System includes
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Magic value at the start of the snapshot data
+static const char SNAPSHOT_MAGIC[8] = { 'C', 'P', 'P', 'C', 'F', 'G', 'S', 'S' };
+
+//! Version of the snapshot format
+static constexpr uint32_t SNAPSHOT_VERSION = 1U;
+
+//! Value used for a missing index (name of the root node and parent of the root node)
+static constexpr uint32_t NO_INDEX = 0xFFFFFFFFU;
+
+//! Size of the header
+static constexpr uint64_t HEADER_SIZE = 72U;
+
+//! Size of a record in the string table (offset and size)
+static constexpr uint64_t STRING_RECORD_SIZE = 8U;
+
+//! Size of a record in the node table (kind, name, parent, auxiliary value and payload)
+static constexpr uint64_t NODE_RECORD_SIZE = 24U;
+
+//! Size of a record in the member table (node index)
+static constexpr uint64_t MEMBER_RECORD_SIZE = 4U;
+
+//! Kinds of node records
+enum NodeKind : uint32_t
+{
+    NodeKind_Object = 0U,   //!< Object node (aux: member count, payload: index of the first member)
+    NodeKind_Null = 1U,     //!< Value node with a null value
+    NodeKind_Bool = 2U,     //!< Value node with a boolean value (payload: 0 or 1)
+    NodeKind_Double = 3U,   //!< Value node with a number (payload: bits of a double)
+    NodeKind_String = 4U,   //!< Value node with a string (aux: string index)
+    NodeKind_Blob = 5U      //!< Value node with an array or object (aux: size, payload: offset)
+};
+
+//! Holds the decoded snapshot header
+struct SnapshotHeader
+{
+    //! Number of nodes
+    uint32_t nodeCount;
+
+    //! Number of records in the member table
+    uint32_t memberCount;
+
+    //! Number of strings
+    uint32_t stringCount;
+
+    //! Offset of the string table
+    uint64_t stringTableOffset;
+
+    //! Offset of the string data
+    uint64_t stringDataOffset;
+
+    //! Offset of the node table
+    uint64_t nodeTableOffset;
+
+    //! Offset of the member table
+    uint64_t memberTableOffset;
+
+    //! Offset of the value blobs
+    uint64_t blobOffset;
+
+    //! Total size of the snapshot data
+    uint64_t totalSize;
+};
+
+//! Holds a decoded node record
+struct NodeRecord
+{
+    //! Node kind
+    uint32_t kind;
+
+    //! Index of the name in the string table
+    uint32_t name;
+
+    //! Index of the parent node
+    uint32_t parent;
+
+    //! Auxiliary value (depends on the node kind)
+    uint32_t aux;
+
+    //! Payload (depends on the node kind)
+    uint64_t payload;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads an unsigned 32-bit integer from the snapshot data
+ *
+ * \param   data    Snapshot data
+ * \param   offset  Offset of the value
+ *
+ * \return  Value
+ */
+static inline uint32_t readUInt32(const char *data, const uint64_t offset)
+{
+    return qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(data + offset));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads an unsigned 64-bit integer from the snapshot data
+ *
+ * \param   data    Snapshot data
+ * \param   offset  Offset of the value
+ *
+ * \return  Value
+ */
+static inline uint64_t readUInt64(const char *data, const uint64_t offset)
+{
+    return qFromLittleEndian<quint64>(reinterpret_cast<const uchar *>(data + offset));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Appends an unsigned 32-bit integer to the snapshot data
+ *
+ * \param   value   Value
+ *
+ * \param[in,out]   data    Snapshot data
+ */
+static void appendUInt32(const uint32_t value, QByteArray *data)
+{
+    uchar buffer[sizeof(quint32)];
+    qToLittleEndian<quint32>(value, buffer);
+    data->append(reinterpret_cast<const char *>(buffer), sizeof(buffer));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Appends an unsigned 64-bit integer to the snapshot data
+ *
+ * \param   value   Value
+ *
+ * \param[in,out]   data    Snapshot data
+ */
+static void appendUInt64(const uint64_t value, QByteArray *data)
+{
+    uchar buffer[sizeof(quint64)];
+    qToLittleEndian<quint64>(value, buffer);
+    data->append(reinterpret_cast<const char *>(buffer), sizeof(buffer));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Appends padding to the snapshot data so that its size is aligned to 8 bytes
+ *
+ * \param[in,out]   data    Snapshot data
+ */
+static void appendPadding(QByteArray *data)
+{
+    while ((data->size() % 8) != 0)
+    {
+        data->append('\0');
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Decodes the snapshot header
+ *
+ * \param   data    Snapshot data
+ *
+ * \return  Snapshot header
+ */
+static SnapshotHeader readHeader(const char *data)
+{
+    SnapshotHeader header {};
+    header.nodeCount = readUInt32(data, 12U);
+    header.memberCount = readUInt32(data, 16U);
+    header.stringCount = readUInt32(data, 20U);
+    header.stringTableOffset = readUInt64(data, 24U);
+    header.stringDataOffset = readUInt64(data, 32U);
+    header.nodeTableOffset = readUInt64(data, 40U);
+    header.memberTableOffset = readUInt64(data, 48U);
+    header.blobOffset = readUInt64(data, 56U);
+    header.totalSize = readUInt64(data, 64U);
+    return header;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Decodes a node record
+ *
+ * \param   data    Snapshot data
+ * \param   header  Snapshot header
+ * \param   index   Node index
+ *
+ * \return  Node record
+ */
+static NodeRecord readNodeRecord(const char *data, const SnapshotHeader &header, const uint32_t index)
+{
+    const uint64_t offset = header.nodeTableOffset + (index * NODE_RECORD_SIZE);
+
+    NodeRecord record {};
+    record.kind = readUInt32(data, offset);
+    record.name = readUInt32(data, offset + 4U);
+    record.parent = readUInt32(data, offset + 8U);
+    record.aux = readUInt32(data, offset + 12U);
+    record.payload = readUInt64(data, offset + 16U);
+    return record;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets a string from the string table
+ *
+ * \param   data    Snapshot data
+ * \param   header  Snapshot header
+ * \param   index   String index
+ *
+ * \return  Pointer to the string data (UTF-8) and its size
+ */
+static std::pair<const char *, int> readString(const char *data,
+                                               const SnapshotHeader &header,
+                                               const uint32_t index)
+{
+    const uint64_t offset = header.stringTableOffset + (index * STRING_RECORD_SIZE);
+
+    return std::make_pair(data + header.stringDataOffset + readUInt32(data, offset),
+                          static_cast<int>(readUInt32(data, offset + 4U)));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Compares two UTF-8 strings byte by byte
+ *
+ * \param   left    String
+ * \param   right   String
+ *
+ * \return  Negative value, zero or positive value if the left string is less than, equal to or
+ *          greater than the right string
+ */
+static int compareStrings(const std::pair<const char *, int> &left,
+                          const std::pair<const char *, int> &right)
+{
+    const int result = std::memcmp(left.first,
+                                   right.first,
+                                   static_cast<size_t>(std::min(left.second, right.second)));
+
+    if (result != 0)
+    {
+        return result;
+    }
+
+    return left.second - right.second;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+//! Builds the snapshot data from configuration nodes
+class SnapshotWriter
+{
+public:
+    /*!
+     * Adds the node (with its subtree) to the snapshot
+     *
+     * \param   node        Configuration node
+     * \param   name        Index of the node name
+     * \param   parent      Index of the parent node
+     *
+     * \param[out]  index   Index of the added node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool addNode(const ConfigNode &node, const uint32_t name, const uint32_t parent, uint32_t *index)
+    {
+        *index = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.push_back(NodeRecord { NodeKind_Null, name, parent, 0U, 0U });
+
+        NodeRecord record = m_nodes.back();
+
+        switch (node.type())
+        {
+            case ConfigNode::Type::Object:
+            {
+                // Members are sorted by their UTF-8 representation so that they can be found with a
+                // binary search directly in the snapshot data
+                const auto &objectNode = node.toObject();
+                std::vector<std::pair<QByteArray, const ConfigNode *>> members;
+                members.reserve(static_cast<size_t>(objectNode.count()));
+
+                for (const auto &memberName : objectNode.names())
+                {
+                    members.emplace_back(memberName.toUtf8(), objectNode.member(memberName));
+                }
+
+                std::sort(members.begin(),
+                          members.end(),
+                          [](const std::pair<QByteArray, const ConfigNode *> &left,
+                             const std::pair<QByteArray, const ConfigNode *> &right)
+                          {
+                              return (left.first < right.first);
+                          });
+
+                std::vector<uint32_t> memberIndexes;
+                memberIndexes.reserve(members.size());
+
+                for (const auto &member : members)
+                {
+                    uint32_t memberIndex = 0U;
+
+                    if (!addNode(*member.second, addString(member.first), *index, &memberIndex))
+                    {
+                        return false;
+                    }
+
+                    memberIndexes.push_back(memberIndex);
+                }
+
+                record.kind = NodeKind_Object;
+                record.aux = static_cast<uint32_t>(memberIndexes.size());
+                record.payload = m_members.size();
+                m_members.insert(m_members.end(), memberIndexes.begin(), memberIndexes.end());
+                break;
+            }
+
+            case ConfigNode::Type::Value:
+            {
+                const QJsonValue value = node.toValue().value();
+
+                switch (value.type())
+                {
+                    case QJsonValue::Null:
+                    {
+                        record.kind = NodeKind_Null;
+                        break;
+                    }
+
+                    case QJsonValue::Bool:
+                    {
+                        record.kind = NodeKind_Bool;
+                        record.payload = value.toBool() ? 1U : 0U;
+                        break;
+                    }
+
+                    case QJsonValue::Double:
+                    {
+                        const double number = value.toDouble();
+                        record.kind = NodeKind_Double;
+                        std::memcpy(&record.payload, &number, sizeof(number));
+                        break;
+                    }
+
+                    case QJsonValue::String:
+                    {
+                        record.kind = NodeKind_String;
+                        record.aux = addString(value.toString().toUtf8());
+                        break;
+                    }
+
+                    case QJsonValue::Array:
+                    case QJsonValue::Object:
+                    {
+                        const QJsonDocument document = value.isArray()
+                                                       ? QJsonDocument(value.toArray())
+                                                       : QJsonDocument(value.toObject());
+                        const QByteArray blob = document.toJson(QJsonDocument::Compact);
+
+                        record.kind = NodeKind_Blob;
+                        record.aux = static_cast<uint32_t>(blob.size());
+                        record.payload = static_cast<uint64_t>(m_blobs.size());
+                        m_blobs.append(blob);
+                        break;
+                    }
+
+                    default:
+                    {
+                        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                                << "Undefined value at node path:" << node.nodePath().path();
+                        return false;
+                    }
+                }
+                break;
+            }
+
+            default:
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                        << QString("Unsupported node type [%1] at node path [%2], only Object and "
+                                   "Value nodes can be stored in a snapshot")
+                           .arg(ConfigNode::typeToString(node.type()), node.nodePath().path());
+                return false;
+            }
+        }
+
+        m_nodes[*index] = record;
+        return true;
+    }
+
+    /*!
+     * Creates the snapshot data
+     *
+     * \return  Snapshot data
+     */
+    QByteArray finish() const
+    {
+        // Calculate the layout (all sections are aligned to 8 bytes)
+        auto align = [](const uint64_t value) { return (value + 7U) & ~static_cast<uint64_t>(7U); };
+
+        uint64_t stringDataSize = 0U;
+
+        for (const auto &string : m_strings)
+        {
+            stringDataSize += static_cast<uint64_t>(string.size());
+        }
+
+        const uint64_t stringTableOffset = HEADER_SIZE;
+        const uint64_t stringDataOffset =
+                align(stringTableOffset + (m_strings.size() * STRING_RECORD_SIZE));
+        const uint64_t nodeTableOffset = align(stringDataOffset + stringDataSize);
+        const uint64_t memberTableOffset =
+                align(nodeTableOffset + (m_nodes.size() * NODE_RECORD_SIZE));
+        const uint64_t blobOffset = align(memberTableOffset + (m_members.size() * MEMBER_RECORD_SIZE));
+        const uint64_t totalSize = align(blobOffset + static_cast<uint64_t>(m_blobs.size()));
+
+        QByteArray data;
+        data.reserve(static_cast<int>(totalSize));
+
+        // Header
+        data.append(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        appendUInt32(SNAPSHOT_VERSION, &data);
+        appendUInt32(static_cast<uint32_t>(m_nodes.size()), &data);
+        appendUInt32(static_cast<uint32_t>(m_members.size()), &data);
+        appendUInt32(static_cast<uint32_t>(m_strings.size()), &data);
+        appendUInt64(stringTableOffset, &data);
+        appendUInt64(stringDataOffset, &data);
+        appendUInt64(nodeTableOffset, &data);
+        appendUInt64(memberTableOffset, &data);
+        appendUInt64(blobOffset, &data);
+        appendUInt64(totalSize, &data);
+        Q_ASSERT(static_cast<uint64_t>(data.size()) == HEADER_SIZE);
+
+        // String table and string data
+        uint32_t stringOffset = 0U;
+
+        for (const auto &string : m_strings)
+        {
+            appendUInt32(stringOffset, &data);
+            appendUInt32(static_cast<uint32_t>(string.size()), &data);
+            stringOffset += static_cast<uint32_t>(string.size());
+        }
+
+        appendPadding(&data);
+
+        for (const auto &string : m_strings)
+        {
+            data.append(string);
+        }
+
+        appendPadding(&data);
+
+        // Node table
+        for (const auto &record : m_nodes)
+        {
+            appendUInt32(record.kind, &data);
+            appendUInt32(record.name, &data);
+            appendUInt32(record.parent, &data);
+            appendUInt32(record.aux, &data);
+            appendUInt64(record.payload, &data);
+        }
+
+        appendPadding(&data);
+
+        // Member table
+        for (const uint32_t member : m_members)
+        {
+            appendUInt32(member, &data);
+        }
+
+        appendPadding(&data);
+
+        // Value blobs
+        data.append(m_blobs);
+        appendPadding(&data);
+
+        Q_ASSERT(static_cast<uint64_t>(data.size()) == totalSize);
+        return data;
+    }
+
+private:
+    /*!
+     * Adds a string to the string table (each distinct string is stored only once)
+     *
+     * \param   string  String in UTF-8 format
+     *
+     * \return  String index
+     */
+    uint32_t addString(const QByteArray &string)
+    {
+        auto it = m_stringIndexes.constFind(string);
+
+        if (it != m_stringIndexes.constEnd())
+        {
+            return it.value();
+        }
+
+        const auto index = static_cast<uint32_t>(m_strings.size());
+        m_strings.push_back(string);
+        m_stringIndexes.insert(string, index);
+        return index;
+    }
+
+private:
+    //! Holds the indexes of the strings in the string table
+    QHash<QByteArray, uint32_t> m_stringIndexes;
+
+    //! Holds the strings
+    std::vector<QByteArray> m_strings;
+
+    //! Holds the node records
+    std::vector<NodeRecord> m_nodes;
+
+    //! Holds the member table
+    std::vector<uint32_t> m_members;
+
+    //! Holds the value blobs
+    QByteArray m_blobs;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot::Node::Node(const char *data, const uint32_t index)
+    : m_data(data),
+      m_index(index)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::Node::isValid() const
+{
+    return (m_data != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode::Type ConfigSnapshot::Node::type() const
+{
+    return isObject() ? ConfigNode::Type::Object : ConfigNode::Type::Value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::Node::isObject() const
+{
+    if (!isValid())
+    {
+        return false;
+    }
+
+    return (readNodeRecord(m_data, readHeader(m_data), m_index).kind == NodeKind_Object);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::Node::isValue() const
+{
+    return (isValid() && (!isObject()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::Node::isRoot() const
+{
+    return (isValid() && (m_index == 0U));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot::Node ConfigSnapshot::Node::parent() const
+{
+    if ((!isValid()) || isRoot())
+    {
+        return {};
+    }
+
+    return Node(m_data, readNodeRecord(m_data, readHeader(m_data), m_index).parent);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigSnapshot::Node::nodeName() const
+{
+    if ((!isValid()) || isRoot())
+    {
+        return {};
+    }
+
+    const auto header = readHeader(m_data);
+    const auto name = readString(m_data, header, readNodeRecord(m_data, header, m_index).name);
+
+    return QString::fromUtf8(name.first, name.second);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodePath ConfigSnapshot::Node::nodePath() const
+{
+    if (!isValid())
+    {
+        return {};
+    }
+
+    QStringList names;
+
+    for (Node node = *this; !node.isRoot(); node = node.parent())
+    {
+        names.append(node.nodeName());
+    }
+
+    std::reverse(names.begin(), names.end());
+
+    return ConfigNodePath(ConfigNodePath::ROOT_PATH_VALUE + names.join(QChar('/')));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigSnapshot::Node::count() const
+{
+    if (!isValid())
+    {
+        return 0;
+    }
+
+    const auto record = readNodeRecord(m_data, readHeader(m_data), m_index);
+
+    return (record.kind == NodeKind_Object) ? static_cast<int>(record.aux) : 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigSnapshot::Node::names() const
+{
+    QStringList names;
+    const int memberCount = count();
+
+    for (int i = 0; i < memberCount; i++)
+    {
+        names.append(memberAt(i).nodeName());
+    }
+
+    return names;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::Node::contains(const QString &name) const
+{
+    return member(name).isValid();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot::Node ConfigSnapshot::Node::member(const QString &name) const
+{
+    if (!isObject())
+    {
+        return {};
+    }
+
+    const auto header = readHeader(m_data);
+    const auto record = readNodeRecord(m_data, header, m_index);
+    const QByteArray utf8Name = name.toUtf8();
+    const auto searchedName = std::make_pair(utf8Name.constData(), utf8Name.size());
+
+    // Binary search in the (sorted) members
+    uint32_t low = 0U;
+    uint32_t high = record.aux;
+
+    while (low < high)
+    {
+        const uint32_t middle = low + ((high - low) / 2U);
+        const uint32_t memberIndex =
+                readUInt32(m_data,
+                           header.memberTableOffset +
+                           ((record.payload + middle) * MEMBER_RECORD_SIZE));
+        const auto memberRecord = readNodeRecord(m_data, header, memberIndex);
+        const int result = compareStrings(readString(m_data, header, memberRecord.name),
+                                          searchedName);
+
+        if (result == 0)
+        {
+            return Node(m_data, memberIndex);
+        }
+
+        if (result < 0)
+        {
+            low = middle + 1U;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return {};
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot::Node ConfigSnapshot::Node::memberAt(const int index) const
+{
+    if ((index < 0) || (index >= count()))
+    {
+        return {};
+    }
+
+    const auto header = readHeader(m_data);
+    const auto record = readNodeRecord(m_data, header, m_index);
+    const uint32_t memberIndex =
+            readUInt32(m_data,
+                       header.memberTableOffset +
+                       ((record.payload + static_cast<uint64_t>(index)) * MEMBER_RECORD_SIZE));
+
+    return Node(m_data, memberIndex);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot::Node ConfigSnapshot::Node::nodeAtPath(const ConfigNodePath &nodePath) const
+{
+    if ((!isValid()) || (!nodePath.isValid()))
+    {
+        return {};
+    }
+
+    Node currentNode = nodePath.isAbsolute() ? Node(m_data, 0U) : *this;
+
+    for (const QString &nodeName : nodePath.nodeNames())
+    {
+        // Check if parent node is referenced
+        if (nodeName == ConfigNodePath::PARENT_PATH_VALUE)
+        {
+            if (currentNode.isRoot())
+            {
+                // Error: parent of the root node was requested
+                return {};
+            }
+
+            currentNode = currentNode.parent();
+            continue;
+        }
+
+        // Get the specified member node
+        currentNode = currentNode.member(nodeName);
+
+        if (!currentNode.isValid())
+        {
+            return {};
+        }
+    }
+
+    return currentNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonValue ConfigSnapshot::Node::value() const
+{
+    if (!isValid())
+    {
+        return QJsonValue(QJsonValue::Undefined);
+    }
+
+    const auto header = readHeader(m_data);
+    const auto record = readNodeRecord(m_data, header, m_index);
+
+    switch (record.kind)
+    {
+        case NodeKind_Null:
+        {
+            return QJsonValue(QJsonValue::Null);
+        }
+
+        case NodeKind_Bool:
+        {
+            return QJsonValue(record.payload != 0U);
+        }
+
+        case NodeKind_Double:
+        {
+            double number = 0.0;
+            std::memcpy(&number, &record.payload, sizeof(number));
+            return QJsonValue(number);
+        }
+
+        case NodeKind_String:
+        {
+            const auto string = readString(m_data, header, record.aux);
+            return QJsonValue(QString::fromUtf8(string.first, string.second));
+        }
+
+        case NodeKind_Blob:
+        {
+            const QJsonDocument document = QJsonDocument::fromJson(
+                        QByteArray::fromRawData(m_data + header.blobOffset + record.payload,
+                                                static_cast<int>(record.aux)));
+
+            if (document.isArray())
+            {
+                return document.array();
+            }
+
+            return document.object();
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return QJsonValue(QJsonValue::Undefined);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigNode> ConfigSnapshot::Node::toConfigNode() const
+{
+    if (!isValid())
+    {
+        return {};
+    }
+
+    if (!isObject())
+    {
+        return std::make_unique<ConfigValueNode>(value());
+    }
+
+    auto objectNode = std::make_unique<ConfigObjectNode>();
+    const int memberCount = count();
+
+    for (int i = 0; i < memberCount; i++)
+    {
+        const Node memberNode = memberAt(i);
+        auto member = memberNode.toConfigNode();
+
+        if (!member)
+        {
+            return {};
+        }
+
+        objectNode->setMember(memberNode.nodeName(), std::move(member));
+    }
+
+    return objectNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot::~ConfigSnapshot()
+{
+    close();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QByteArray ConfigSnapshot::serialize(const ConfigObjectNode &config)
+{
+    SnapshotWriter writer;
+    uint32_t rootIndex = 0U;
+
+    if (!writer.addNode(config, NO_INDEX, NO_INDEX, &rootIndex))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                << "Failed to create the snapshot of the configuration";
+        return {};
+    }
+
+    Q_ASSERT(rootIndex == 0U);
+    return writer.finish();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::write(const ConfigObjectNode &config, const QString &filePath)
+{
+    const QByteArray data = serialize(config);
+
+    if (data.isEmpty())
+    {
+        return false;
+    }
+
+    // Write the snapshot atomically so that processes which have the previous snapshot mapped are
+    // not affected
+    QSaveFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                << "Failed to open the snapshot file for writing:" << filePath;
+        return false;
+    }
+
+    if (file.write(data) != static_cast<qint64>(data.size()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                << "Failed to write the snapshot file:" << filePath;
+        return false;
+    }
+
+    if (!file.commit())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                << "Failed to commit the snapshot file:" << filePath;
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::open(const QString &filePath)
+{
+    close();
+
+    auto file = std::make_unique<QFile>(filePath);
+
+    if (!file->open(QIODevice::ReadOnly))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                << "Failed to open the snapshot file:" << filePath;
+        return false;
+    }
+
+    const qint64 size = file->size();
+    const uchar *data = (size > 0) ? file->map(0, size) : nullptr;
+
+    if (data == nullptr)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                << "Failed to memory-map the snapshot file:" << filePath;
+        return false;
+    }
+
+    if (!validate(reinterpret_cast<const char *>(data), size))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot)
+                << "Invalid snapshot file:" << filePath;
+        return false;
+    }
+
+    m_file = std::move(file);
+    m_data = reinterpret_cast<const char *>(data);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::open(const QByteArray &data)
+{
+    close();
+
+    if (!validate(data.constData(), data.size()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigSnapshot) << "Invalid snapshot data";
+        return false;
+    }
+
+    m_buffer = data;
+    m_data = m_buffer.constData();
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigSnapshot::close()
+{
+    // Closing the file also releases its memory-mapping
+    m_file.reset();
+    m_buffer.clear();
+    m_data = nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::isOpen() const
+{
+    return (m_data != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot::Node ConfigSnapshot::rootNode() const
+{
+    if (!isOpen())
+    {
+        return {};
+    }
+
+    return Node(m_data, 0U);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigSnapshot::toConfigNode() const
+{
+    auto node = rootNode().toConfigNode();
+
+    if (!node)
+    {
+        return {};
+    }
+
+    return std::unique_ptr<ConfigObjectNode>(static_cast<ConfigObjectNode *>(node.release()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigSnapshot::validate(const char *data, const qint64 size)
+{
+    // Check the header
+    if ((data == nullptr) ||
+        (size < static_cast<qint64>(HEADER_SIZE)) ||
+        (std::memcmp(data, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) ||
+        (readUInt32(data, 8U) != SNAPSHOT_VERSION))
+    {
+        return false;
+    }
+
+    const auto header = readHeader(data);
+    const auto dataSize = static_cast<uint64_t>(size);
+
+    auto isSectionValid = [dataSize](const uint64_t offset, const uint64_t sectionSize)
+    {
+        return ((offset <= dataSize) && (sectionSize <= (dataSize - offset)));
+    };
+
+    if ((header.totalSize != dataSize) ||
+        (header.nodeCount == 0U) ||
+        (!isSectionValid(header.stringTableOffset, header.stringCount * STRING_RECORD_SIZE)) ||
+        (!isSectionValid(header.stringDataOffset, 0U)) ||
+        (!isSectionValid(header.nodeTableOffset, header.nodeCount * NODE_RECORD_SIZE)) ||
+        (!isSectionValid(header.memberTableOffset, header.memberCount * MEMBER_RECORD_SIZE)) ||
+        (!isSectionValid(header.blobOffset, 0U)))
+    {
+        return false;
+    }
+
+    // Check the strings
+    for (uint32_t i = 0U; i < header.stringCount; i++)
+    {
+        const uint64_t offset = header.stringTableOffset + (i * STRING_RECORD_SIZE);
+
+        if (!isSectionValid(header.stringDataOffset + readUInt32(data, offset),
+                            readUInt32(data, offset + 4U)))
+        {
+            return false;
+        }
+    }
+
+    // Check the nodes (each member must have the Object node that contains it as its parent so that
+    // walking the tree from the root node cannot end up in a loop)
+    for (uint32_t i = 0U; i < header.nodeCount; i++)
+    {
+        const auto record = readNodeRecord(data, header, i);
+
+        if (i == 0U)
+        {
+            if ((record.kind != NodeKind_Object) ||
+                (record.name != NO_INDEX) ||
+                (record.parent != NO_INDEX))
+            {
+                return false;
+            }
+        }
+        else if ((record.name >= header.stringCount) || (record.parent >= header.nodeCount))
+        {
+            return false;
+        }
+
+        switch (record.kind)
+        {
+            case NodeKind_Object:
+            {
+                if ((record.payload > header.memberCount) ||
+                    (record.aux > (header.memberCount - record.payload)))
+                {
+                    return false;
+                }
+
+                for (uint32_t j = 0U; j < record.aux; j++)
+                {
+                    const uint32_t memberIndex =
+                            readUInt32(data,
+                                       header.memberTableOffset +
+                                       ((record.payload + j) * MEMBER_RECORD_SIZE));
+
+                    if ((memberIndex == 0U) ||
+                        (memberIndex >= header.nodeCount) ||
+                        (readNodeRecord(data, header, memberIndex).parent != i))
+                    {
+                        return false;
+                    }
+                }
+                break;
+            }
+
+            case NodeKind_Null:
+            case NodeKind_Bool:
+            case NodeKind_Double:
+            {
+                break;
+            }
+
+            case NodeKind_String:
+            {
+                if (record.aux >= header.stringCount)
+                {
+                    return false;
+                }
+                break;
+            }
+
+            case NodeKind_Blob:
+            {
+                if ((!isSectionValid(header.blobOffset, record.payload)) ||
+                    (!isSectionValid(header.blobOffset + record.payload, record.aux)))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            default:
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace CppConfigFramework
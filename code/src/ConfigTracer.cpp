@@ -0,0 +1,229 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains classes for tracing of the configuration loading in the Chrome trace-event format
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigTracer.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+ConfigTracer *ConfigTracer::instance()
+{
+    static ConfigTracer tracer;
+
+    return &tracer;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigTracer::isEnabled() const
+{
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigTracer::setEnabled(const bool enabled)
+{
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigTracer::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_events = QJsonArray();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigTracer::eventCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_events.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigTracer::timestamp() const
+{
+    return m_timer.nsecsElapsed();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigTracer::addCompleteEvent(const QString &category,
+                                    const QString &name,
+                                    const qint64 startTime,
+                                    const qint64 duration,
+                                    const QJsonObject &arguments)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    // Chrome trace-event format uses timestamps in microseconds
+    QJsonObject event {
+        { QStringLiteral("name"), name },
+        { QStringLiteral("cat"), category },
+        { QStringLiteral("ph"), QStringLiteral("X") },
+        { QStringLiteral("ts"), static_cast<double>(startTime) / 1000.0 },
+        { QStringLiteral("dur"), static_cast<double>(duration) / 1000.0 },
+        { QStringLiteral("pid"), static_cast<double>(QCoreApplication::applicationPid()) }
+    };
+
+    if (!arguments.isEmpty())
+    {
+        event.insert(QStringLiteral("args"), arguments);
+    }
+
+    QMutexLocker locker(&m_mutex);
+    event.insert(QStringLiteral("tid"), currentThreadId());
+    m_events.append(event);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonDocument ConfigTracer::toChromeTrace() const
+{
+    QMutexLocker locker(&m_mutex);
+
+    return QJsonDocument(QJsonObject {
+                             { QStringLiteral("traceEvents"), m_events },
+                             { QStringLiteral("displayTimeUnit"), QStringLiteral("ms") }
+                         });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigTracer::writeChromeTrace(const QString &filePath) const
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    const QByteArray data = toChromeTrace().toJson(QJsonDocument::Compact);
+    return (file.write(data) == static_cast<qint64>(data.size()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigTracer::ConfigTracer()
+    : m_enabled(false)
+{
+    m_timer.start();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigTracer::currentThreadId()
+{
+    const Qt::HANDLE threadHandle = QThread::currentThreadId();
+    auto it = m_threadIds.find(threadHandle);
+
+    if (it == m_threadIds.end())
+    {
+        it = m_threadIds.insert(threadHandle, m_threadIds.size() + 1);
+    }
+
+    return it.value();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigTraceSpan::ConfigTraceSpan(const QString &category, const QString &name)
+    : m_startTime(-1)
+{
+    const auto *tracer = ConfigTracer::instance();
+
+    if (tracer->isEnabled())
+    {
+        m_category = category;
+        m_name = name;
+        m_startTime = tracer->timestamp();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigTraceSpan::~ConfigTraceSpan()
+{
+    if (!isActive())
+    {
+        return;
+    }
+
+    auto *tracer = ConfigTracer::instance();
+    tracer->addCompleteEvent(m_category,
+                             m_name,
+                             m_startTime,
+                             tracer->timestamp() - m_startTime,
+                             m_arguments);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigTraceSpan::isActive() const
+{
+    return (m_startTime >= 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigTraceSpan::setName(const QString &name)
+{
+    if (isActive())
+    {
+        m_name = name;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigTraceSpan::setArgument(const QString &name, const QJsonValue &value)
+{
+    if (isActive())
+    {
+        m_arguments.insert(name, value);
+    }
+}
+
+} // namespace CppConfigFramework
@@ -24,8 +24,12 @@
 // C++ Config Framework includes
 
 // Qt includes
+#include <QtCore/QSharedData>
 
 // System includes
+#include <algorithm>
+#include <cstring>
+#include <new>
 
 // Forward declarations
 
@@ -36,17 +40,97 @@
 namespace CppConfigFramework
 {
 
+constexpr int ConfigValueNode::DATA_SIZE;
+constexpr int ConfigValueNode::SHORT_STRING_CAPACITY;
+
+// -------------------------------------------------------------------------------------------------
+
+struct ConfigValueNode::SharedValue : public QSharedData
+{
+    /*!
+     * Constructor
+     *
+     * \param   sharedValue Shared value
+     */
+    explicit SharedValue(const QJsonValue &sharedValue)
+        : value(sharedValue)
+    {
+    }
+
+    //! Shared value
+    const QJsonValue value;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the string can be stored inline
+ *
+ * \param   string      String
+ * \param   capacity    Max number of characters of a string stored inline
+ *
+ * \retval  true    String is short and it has only Latin-1 characters
+ * \retval  false   String cannot be stored inline
+ */
+static bool isShortString(const QString &string, const int capacity)
+{
+    if (string.size() > capacity)
+    {
+        return false;
+    }
+
+    return std::all_of(string.begin(), string.end(), [](const QChar character)
+    {
+        return (character.unicode() <= 0xFFU);
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
 ConfigValueNode::ConfigValueNode(const QJsonValue &value, ConfigObjectNode *parent)
     : ConfigNode(parent),
-      m_value(value)
+      m_storage(Storage::Undefined)
+{
+    assign(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigValueNode::ConfigValueNode(ConfigValueNode &&other) noexcept
+    : ConfigNode(std::move(other)),
+      m_storage(Storage::Undefined)
+{
+    moveFrom(other);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigValueNode::~ConfigValueNode()
 {
+    reset();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigValueNode &ConfigValueNode::operator=(ConfigValueNode &&other) noexcept
+{
+    if (this != &other)
+    {
+        ConfigNode::operator=(std::move(other));
+        reset();
+        moveFrom(other);
+    }
+
+    return *this;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 std::unique_ptr<ConfigNode> ConfigValueNode::clone() const
 {
-    return std::make_unique<ConfigValueNode>(m_value, nullptr);
+    auto node = std::make_unique<ConfigValueNode>(QJsonValue(QJsonValue::Undefined), nullptr);
+    node->assign(*this);
+    return node;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -60,14 +144,250 @@ ConfigNode::Type ConfigValueNode::type() const
 
 QJsonValue ConfigValueNode::value() const
 {
-    return m_value;
+    switch (m_storage)
+    {
+        case Storage::Null:
+        {
+            return QJsonValue(QJsonValue::Null);
+        }
+
+        case Storage::Bool:
+        {
+            bool value = false;
+            std::memcpy(&value, m_data, sizeof(value));
+            return QJsonValue(value);
+        }
+
+        case Storage::Double:
+        {
+            double value = 0.0;
+            std::memcpy(&value, m_data, sizeof(value));
+            return QJsonValue(value);
+        }
+
+        case Storage::ShortString:
+        {
+            const int size = static_cast<int>(m_data[SHORT_STRING_CAPACITY]);
+            return QJsonValue(QString::fromLatin1(m_data, size));
+        }
+
+        case Storage::String:
+        {
+            return QJsonValue(*string());
+        }
+
+        case Storage::Composite:
+        {
+            return sharedValue()->value;
+        }
+
+        case Storage::Undefined:
+        default:
+        {
+            break;
+        }
+    }
+
+    return QJsonValue(QJsonValue::Undefined);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 void ConfigValueNode::setValue(const QJsonValue &value)
 {
-    m_value = value;
+    reset();
+    assign(value);
+    invalidateParentSharedMembers();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigValueNode::setValue(const ConfigValueNode &other)
+{
+    if (this != &other)
+    {
+        reset();
+        assign(other);
+    }
+
+    invalidateParentSharedMembers();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigValueNode::assign(const QJsonValue &value)
+{
+    Q_ASSERT(m_storage == Storage::Undefined);
+
+    switch (value.type())
+    {
+        case QJsonValue::Null:
+        {
+            m_storage = Storage::Null;
+            break;
+        }
+
+        case QJsonValue::Bool:
+        {
+            const bool boolValue = value.toBool();
+            std::memcpy(m_data, &boolValue, sizeof(boolValue));
+            m_storage = Storage::Bool;
+            break;
+        }
+
+        case QJsonValue::Double:
+        {
+            const double doubleValue = value.toDouble();
+            std::memcpy(m_data, &doubleValue, sizeof(doubleValue));
+            m_storage = Storage::Double;
+            break;
+        }
+
+        case QJsonValue::String:
+        {
+            const QString stringValue = value.toString();
+
+            if (isShortString(stringValue, SHORT_STRING_CAPACITY))
+            {
+                for (int i = 0; i < stringValue.size(); i++)
+                {
+                    m_data[i] = static_cast<char>(stringValue.at(i).unicode());
+                }
+
+                m_data[SHORT_STRING_CAPACITY] = static_cast<char>(stringValue.size());
+                m_storage = Storage::ShortString;
+            }
+            else
+            {
+                new (m_data) QString(stringValue);
+                m_storage = Storage::String;
+            }
+            break;
+        }
+
+        case QJsonValue::Array:
+        case QJsonValue::Object:
+        {
+            SharedValue *shared = new SharedValue(value);
+            shared->ref.ref();
+            std::memcpy(m_data, &shared, sizeof(shared));
+            m_storage = Storage::Composite;
+            break;
+        }
+
+        case QJsonValue::Undefined:
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigValueNode::assign(const ConfigValueNode &other)
+{
+    Q_ASSERT(m_storage == Storage::Undefined);
+
+    switch (other.m_storage)
+    {
+        case Storage::String:
+        {
+            new (m_data) QString(*other.string());
+            break;
+        }
+
+        case Storage::Composite:
+        {
+            other.sharedValue()->ref.ref();
+            std::memcpy(m_data, other.m_data, sizeof(m_data));
+            break;
+        }
+
+        default:
+        {
+            std::memcpy(m_data, other.m_data, sizeof(m_data));
+            break;
+        }
+    }
+
+    m_storage = other.m_storage;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigValueNode::moveFrom(ConfigValueNode &other) noexcept
+{
+    Q_ASSERT(m_storage == Storage::Undefined);
+
+    if (other.m_storage == Storage::String)
+    {
+        new (m_data) QString(std::move(*other.string()));
+        other.string()->~QString();
+    }
+    else
+    {
+        // The ownership of the shared value is transferred together with the pointer
+        std::memcpy(m_data, other.m_data, sizeof(m_data));
+    }
+
+    m_storage = other.m_storage;
+    other.m_storage = Storage::Undefined;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigValueNode::reset() noexcept
+{
+    switch (m_storage)
+    {
+        case Storage::String:
+        {
+            string()->~QString();
+            break;
+        }
+
+        case Storage::Composite:
+        {
+            SharedValue *shared = sharedValue();
+
+            if (!shared->ref.deref())
+            {
+                delete shared;
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    m_storage = Storage::Undefined;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QString *ConfigValueNode::string() const
+{
+    return reinterpret_cast<const QString *>(m_data);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString *ConfigValueNode::string()
+{
+    return reinterpret_cast<QString *>(m_data);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigValueNode::SharedValue *ConfigValueNode::sharedValue() const
+{
+    SharedValue *shared = nullptr;
+    std::memcpy(&shared, m_data, sizeof(shared));
+    return shared;
 }
 
 } // namespace CppConfigFramework
@@ -63,6 +63,7 @@ QStringList EnvironmentVariables::names() const
 
 bool EnvironmentVariables::contains(const QString &name) const
 {
+    recordRead(name);
     return m_variables.contains(name);
 }
 
@@ -70,6 +71,7 @@ bool EnvironmentVariables::contains(const QString &name) const
 
 QString EnvironmentVariables::value(const QString &name) const
 {
+    recordRead(name);
     return m_variables[name];
 }
 
@@ -77,6 +79,11 @@ QString EnvironmentVariables::value(const QString &name) const
 
 void EnvironmentVariables::setValue(const QString &name, const QString &value)
 {
+    if (!m_accessRecords.empty())
+    {
+        m_accessRecords.back().writtenNames.insert(name);
+    }
+
     m_variables[name] = value;
 }
 
@@ -127,4 +134,53 @@ QString EnvironmentVariables::expandText(const QString &text) const
     return expandedText;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+void EnvironmentVariables::startAccessRecording()
+{
+    m_accessRecords.push_back(AccessRecord());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+EnvironmentVariables::AccessRecord EnvironmentVariables::stopAccessRecording()
+{
+    if (m_accessRecords.empty())
+    {
+        return {};
+    }
+
+    AccessRecord record = std::move(m_accessRecords.back());
+    m_accessRecords.pop_back();
+
+    // Add the accessed environment variables to the enclosing recording
+    if (!m_accessRecords.empty())
+    {
+        auto &enclosingRecord = m_accessRecords.back();
+
+        for (const QString &name : record.readNames)
+        {
+            if (!enclosingRecord.writtenNames.contains(name))
+            {
+                enclosingRecord.readNames.insert(name);
+            }
+        }
+
+        enclosingRecord.writtenNames.unite(record.writtenNames);
+    }
+
+    return record;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void EnvironmentVariables::recordRead(const QString &name) const
+{
+    // Only the values which were not set during the recording are inputs of the recorded procedure
+    if ((!m_accessRecords.empty()) && (!m_accessRecords.back().writtenNames.contains(name)))
+    {
+        m_accessRecords.back().readNames.insert(name);
+    }
+}
+
 } // namespace CppConfigFramework
@@ -0,0 +1,947 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for reading JSON data directly from a byte stream
+ */
+
+// Own header
+#include <CppConfigFramework/JsonStreamReader.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QLocale>
+#include <QtCore/QtNumeric>
+
+// System includes
+#include <cstdint>
+#include <cstring>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * Checks if the character is a decimal digit
+ *
+ * \param   character   Character
+ *
+ * \retval  true    Character is a decimal digit
+ * \retval  false   Character is not a decimal digit
+ */
+static inline bool isDigit(const char character)
+{
+    return ((character >= '0') && (character <= '9'));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Converts a hexadecimal digit to its value
+ *
+ * \param   character   Character
+ *
+ * \return  Value of the hexadecimal digit or -1 if the character is not a hexadecimal digit
+ */
+static inline int hexDigitValue(const char character)
+{
+    if (isDigit(character))
+    {
+        return character - '0';
+    }
+
+    if ((character >= 'a') && (character <= 'f'))
+    {
+        return character - 'a' + 10;
+    }
+
+    if ((character >= 'A') && (character <= 'F'))
+    {
+        return character - 'A' + 10;
+    }
+
+    return -1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the length of a well-formed UTF-8 sequence of a non-ASCII character
+ *
+ * \param   data    Data starting with the first byte of the sequence
+ * \param   size    Number of bytes available in the data
+ *
+ * \return  Length of the sequence (in bytes) or 0 if it is not a well-formed UTF-8 sequence
+ *
+ * \note    Overlong encodings, encoded surrogates and code points above U+10FFFF are rejected (the
+ *          same as by QJsonDocument)
+ */
+static int utf8SequenceLength(const char *data, const int size)
+{
+    const uint8_t leadByte = static_cast<uint8_t>(data[0]);
+    int length = 0;
+    uint32_t codePoint = 0U;
+    uint32_t minCodePoint = 0U;
+
+    if ((leadByte & 0xE0U) == 0xC0U)
+    {
+        length = 2;
+        codePoint = leadByte & 0x1FU;
+        minCodePoint = 0x80U;
+    }
+    else if ((leadByte & 0xF0U) == 0xE0U)
+    {
+        length = 3;
+        codePoint = leadByte & 0x0FU;
+        minCodePoint = 0x800U;
+    }
+    else if ((leadByte & 0xF8U) == 0xF0U)
+    {
+        length = 4;
+        codePoint = leadByte & 0x07U;
+        minCodePoint = 0x10000U;
+    }
+    else
+    {
+        // Continuation byte or an invalid lead byte
+        return 0;
+    }
+
+    if (length > size)
+    {
+        return 0;
+    }
+
+    for (int i = 1; i < length; i++)
+    {
+        const uint8_t continuationByte = static_cast<uint8_t>(data[i]);
+
+        if ((continuationByte & 0xC0U) != 0x80U)
+        {
+            return 0;
+        }
+
+        codePoint = (codePoint << 6U) | (continuationByte & 0x3FU);
+    }
+
+    if ((codePoint < minCodePoint) ||
+        (codePoint > 0x10FFFFU) ||
+        ((codePoint >= 0xD800U) && (codePoint <= 0xDFFFU)))
+    {
+        return 0;
+    }
+
+    return length;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Converts a number (which was already validated against the JSON number syntax) to a double
+ *
+ * \param       data    Characters of the number
+ * \param       size    Number of characters
+ * \param[out]  ok      Output for the flag which tells if the conversion succeeded
+ *
+ * \return  Converted number
+ *
+ * The conversion does not depend on the locale and it does not allocate memory unless the number
+ * is unusually long.
+ */
+static double convertNumber(const char *data, const int size, bool *ok)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    static const QLocale cLocale = QLocale::c();
+    constexpr int bufferSize = 64;
+
+    if (size <= bufferSize)
+    {
+        QChar buffer[bufferSize];
+
+        for (int i = 0; i < size; i++)
+        {
+            buffer[i] = QLatin1Char(data[i]);
+        }
+
+        return cLocale.toDouble(QStringView(buffer, size), ok);
+    }
+#endif
+
+    return QByteArray(data, size).toDouble(ok);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+JsonStreamReader::JsonStreamReader(const char *data, const int size)
+    : m_data(data),
+      m_size((data != nullptr) ? size : 0)
+{
+    // Skip the UTF-8 byte order mark
+    if ((m_size >= 3) &&
+        (static_cast<uint8_t>(m_data[0]) == 0xEFU) &&
+        (static_cast<uint8_t>(m_data[1]) == 0xBBU) &&
+        (static_cast<uint8_t>(m_data[2]) == 0xBFU))
+    {
+        m_offset = 3;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+JsonStreamReader::JsonStreamReader(const QByteArray &data)
+    : JsonStreamReader(data.constData(), data.size())
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::hasError() const
+{
+    return (m_errorString != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString JsonStreamReader::errorString() const
+{
+    if (m_errorString == nullptr)
+    {
+        return {};
+    }
+
+    return QString::fromLatin1(m_errorString);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int JsonStreamReader::errorOffset() const
+{
+    return m_errorOffset;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int JsonStreamReader::offset() const
+{
+    return m_offset;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void JsonStreamReader::setOffset(const int offset)
+{
+    m_offset = qBound(0, offset, m_size);
+    m_depth = 0;
+    m_firstMember = false;
+    m_errorString = nullptr;
+    m_errorOffset = -1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::readEnd()
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    if (skipWhitespace())
+    {
+        return setError("garbage at the end of the document");
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonValue::Type JsonStreamReader::peekType()
+{
+    if (hasError() || (!skipWhitespace()))
+    {
+        return QJsonValue::Undefined;
+    }
+
+    const char character = m_data[m_offset];
+
+    switch (character)
+    {
+        case '{':
+        {
+            return QJsonValue::Object;
+        }
+
+        case '[':
+        {
+            return QJsonValue::Array;
+        }
+
+        case '"':
+        {
+            return QJsonValue::String;
+        }
+
+        case 't':
+        case 'f':
+        {
+            return QJsonValue::Bool;
+        }
+
+        case 'n':
+        {
+            return QJsonValue::Null;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if ((character == '-') || isDigit(character))
+    {
+        return QJsonValue::Double;
+    }
+
+    return QJsonValue::Undefined;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::beginObject()
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    if ((!skipWhitespace()) || (m_data[m_offset] != '{'))
+    {
+        return setError("expected an object");
+    }
+
+    if (m_depth >= m_maxDepth)
+    {
+        return setError("too deeply nested document");
+    }
+
+    m_offset++;
+    m_depth++;
+    m_firstMember = true;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::nextMember(QString *name)
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    if (!skipWhitespace())
+    {
+        return setError("unterminated object");
+    }
+
+    // Check for the end of the object or the separator between the members
+    if (m_data[m_offset] == '}')
+    {
+        m_offset++;
+        m_depth--;
+        m_firstMember = false;
+        return false;
+    }
+
+    if (m_firstMember)
+    {
+        m_firstMember = false;
+    }
+    else
+    {
+        if (m_data[m_offset] != ',')
+        {
+            return setError("missing value separator");
+        }
+
+        m_offset++;
+
+        if (!skipWhitespace())
+        {
+            return setError("unterminated object");
+        }
+    }
+
+    // Read member name
+    if (m_data[m_offset] != '"')
+    {
+        return setError("illegal member name");
+    }
+
+    if (!readString(name))
+    {
+        return false;
+    }
+
+    if ((!skipWhitespace()) || (m_data[m_offset] != ':'))
+    {
+        return setError("missing name separator");
+    }
+
+    m_offset++;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonValue JsonStreamReader::readValue()
+{
+    QJsonValue value;
+
+    if (hasError() || (!readOrSkipValue(&value)))
+    {
+        return QJsonValue(QJsonValue::Undefined);
+    }
+
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::skipValue()
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    return readOrSkipValue(nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::skipWhitespace()
+{
+    while (m_offset < m_size)
+    {
+        switch (m_data[m_offset])
+        {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+            {
+                m_offset++;
+                break;
+            }
+
+            default:
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::readString(QString *value)
+{
+    Q_ASSERT(m_data[m_offset] == '"');
+    m_offset++;
+
+    // Strings without escape sequences are converted in one step, otherwise the string is assembled
+    // from the segments between the escape sequences
+    QString escapedValue;
+    bool escaped = false;
+    int segmentStart = m_offset;
+
+    while (m_offset < m_size)
+    {
+        const char character = m_data[m_offset];
+
+        if (character == '"')
+        {
+            if (value != nullptr)
+            {
+                const QString segment = QString::fromUtf8(m_data + segmentStart,
+                                                          m_offset - segmentStart);
+
+                if (escaped)
+                {
+                    escapedValue.append(segment);
+                    *value = escapedValue;
+                }
+                else
+                {
+                    *value = segment;
+                }
+            }
+
+            m_offset++;
+            return true;
+        }
+
+        if (character == '\\')
+        {
+            if (value != nullptr)
+            {
+                escapedValue.append(QString::fromUtf8(m_data + segmentStart,
+                                                      m_offset - segmentStart));
+            }
+
+            escaped = true;
+            m_offset++;
+
+            if (m_offset >= m_size)
+            {
+                break;
+            }
+
+            QChar escapedCharacter;
+
+            switch (m_data[m_offset])
+            {
+                case '"':
+                case '\\':
+                case '/':
+                {
+                    escapedCharacter = QLatin1Char(m_data[m_offset]);
+                    break;
+                }
+
+                case 'b':
+                {
+                    escapedCharacter = QLatin1Char('\b');
+                    break;
+                }
+
+                case 'f':
+                {
+                    escapedCharacter = QLatin1Char('\f');
+                    break;
+                }
+
+                case 'n':
+                {
+                    escapedCharacter = QLatin1Char('\n');
+                    break;
+                }
+
+                case 'r':
+                {
+                    escapedCharacter = QLatin1Char('\r');
+                    break;
+                }
+
+                case 't':
+                {
+                    escapedCharacter = QLatin1Char('\t');
+                    break;
+                }
+
+                case 'u':
+                {
+                    // UTF-16 code unit (surrogate pairs are just two consecutive code units)
+                    if ((m_offset + 4) >= m_size)
+                    {
+                        return setError("illegal escape sequence");
+                    }
+
+                    int codeUnit = 0;
+
+                    for (int i = 1; i <= 4; i++)
+                    {
+                        const int digitValue = hexDigitValue(m_data[m_offset + i]);
+
+                        if (digitValue < 0)
+                        {
+                            return setError("illegal escape sequence");
+                        }
+
+                        codeUnit = (codeUnit * 16) + digitValue;
+                    }
+
+                    escapedCharacter = QChar(static_cast<ushort>(codeUnit));
+                    m_offset += 4;
+                    break;
+                }
+
+                default:
+                {
+                    return setError("illegal escape sequence");
+                }
+            }
+
+            if (value != nullptr)
+            {
+                escapedValue.append(escapedCharacter);
+            }
+
+            m_offset++;
+            segmentStart = m_offset;
+            continue;
+        }
+
+        if (static_cast<uint8_t>(character) < 0x20U)
+        {
+            return setError("illegal value");
+        }
+
+        if (static_cast<uint8_t>(character) >= 0x80U)
+        {
+            // Non-ASCII characters must be well-formed UTF-8 sequences (QString::fromUtf8() would
+            // replace the invalid ones)
+            const int sequenceLength = utf8SequenceLength(m_data + m_offset, m_size - m_offset);
+
+            if (sequenceLength == 0)
+            {
+                return setError("illegal UTF8 sequence");
+            }
+
+            m_offset += sequenceLength;
+            continue;
+        }
+
+        m_offset++;
+    }
+
+    return setError("unterminated string");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::readNumber(double *value)
+{
+    const int start = m_offset;
+
+    // Sign
+    if (m_data[m_offset] == '-')
+    {
+        m_offset++;
+    }
+
+    // Integer part
+    if (m_offset >= m_size)
+    {
+        return setError("illegal number");
+    }
+
+    if (m_data[m_offset] == '0')
+    {
+        m_offset++;
+    }
+    else if (isDigit(m_data[m_offset]))
+    {
+        while ((m_offset < m_size) && isDigit(m_data[m_offset]))
+        {
+            m_offset++;
+        }
+    }
+    else
+    {
+        return setError("illegal number");
+    }
+
+    // Fraction part
+    if ((m_offset < m_size) && (m_data[m_offset] == '.'))
+    {
+        m_offset++;
+
+        if ((m_offset >= m_size) || (!isDigit(m_data[m_offset])))
+        {
+            return setError("illegal number");
+        }
+
+        while ((m_offset < m_size) && isDigit(m_data[m_offset]))
+        {
+            m_offset++;
+        }
+    }
+
+    // Exponent part
+    if ((m_offset < m_size) && ((m_data[m_offset] == 'e') || (m_data[m_offset] == 'E')))
+    {
+        m_offset++;
+
+        if ((m_offset < m_size) && ((m_data[m_offset] == '+') || (m_data[m_offset] == '-')))
+        {
+            m_offset++;
+        }
+
+        if ((m_offset >= m_size) || (!isDigit(m_data[m_offset])))
+        {
+            return setError("illegal number");
+        }
+
+        while ((m_offset < m_size) && isDigit(m_data[m_offset]))
+        {
+            m_offset++;
+        }
+    }
+
+    // Convert the number (also when it is skipped so that numbers out of range are rejected)
+    bool ok = false;
+    const double number = convertNumber(m_data + start, m_offset - start, &ok);
+
+    if ((!ok) || (!qIsFinite(number)))
+    {
+        m_offset = start;
+        return setError("illegal number");
+    }
+
+    if (value != nullptr)
+    {
+        *value = number;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::readLiteral(const char *literal)
+{
+    const int length = static_cast<int>(std::strlen(literal));
+
+    if (((m_offset + length) > m_size) ||
+        (std::memcmp(m_data + m_offset, literal, static_cast<size_t>(length)) != 0))
+    {
+        return setError("illegal value");
+    }
+
+    m_offset += length;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::readOrSkipValue(QJsonValue *value)
+{
+    switch (peekType())
+    {
+        case QJsonValue::Object:
+        {
+            if (!beginObject())
+            {
+                return false;
+            }
+
+            QJsonObject object;
+            QString name;
+
+            while (nextMember((value != nullptr) ? &name : nullptr))
+            {
+                if (value != nullptr)
+                {
+                    QJsonValue memberValue;
+
+                    if (!readOrSkipValue(&memberValue))
+                    {
+                        return false;
+                    }
+
+                    object.insert(name, memberValue);
+                }
+                else if (!readOrSkipValue(nullptr))
+                {
+                    return false;
+                }
+            }
+
+            if (hasError())
+            {
+                return false;
+            }
+
+            if (value != nullptr)
+            {
+                *value = object;
+            }
+
+            return true;
+        }
+
+        case QJsonValue::Array:
+        {
+            if (m_depth >= m_maxDepth)
+            {
+                return setError("too deeply nested document");
+            }
+
+            m_offset++;
+            m_depth++;
+
+            QJsonArray array;
+
+            if (!skipWhitespace())
+            {
+                return setError("unterminated array");
+            }
+
+            if (m_data[m_offset] != ']')
+            {
+                while (true)
+                {
+                    QJsonValue item;
+
+                    if (!readOrSkipValue((value != nullptr) ? &item : nullptr))
+                    {
+                        return false;
+                    }
+
+                    if (value != nullptr)
+                    {
+                        array.append(item);
+                    }
+
+                    if (!skipWhitespace())
+                    {
+                        return setError("unterminated array");
+                    }
+
+                    if (m_data[m_offset] == ']')
+                    {
+                        break;
+                    }
+
+                    if (m_data[m_offset] != ',')
+                    {
+                        return setError("missing value separator");
+                    }
+
+                    m_offset++;
+                }
+            }
+
+            m_offset++;
+            m_depth--;
+
+            if (value != nullptr)
+            {
+                *value = array;
+            }
+
+            return true;
+        }
+
+        case QJsonValue::String:
+        {
+            if (value == nullptr)
+            {
+                return readString(nullptr);
+            }
+
+            QString string;
+
+            if (!readString(&string))
+            {
+                return false;
+            }
+
+            *value = string;
+            return true;
+        }
+
+        case QJsonValue::Double:
+        {
+            double number = 0.0;
+
+            if (!readNumber(&number))
+            {
+                return false;
+            }
+
+            if (value != nullptr)
+            {
+                *value = number;
+            }
+
+            return true;
+        }
+
+        case QJsonValue::Bool:
+        {
+            const bool boolean = (m_data[m_offset] == 't');
+
+            if (!readLiteral(boolean ? "true" : "false"))
+            {
+                return false;
+            }
+
+            if (value != nullptr)
+            {
+                *value = boolean;
+            }
+
+            return true;
+        }
+
+        case QJsonValue::Null:
+        {
+            if (!readLiteral("null"))
+            {
+                return false;
+            }
+
+            if (value != nullptr)
+            {
+                *value = QJsonValue(QJsonValue::Null);
+            }
+
+            return true;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if (hasError())
+    {
+        return false;
+    }
+
+    return setError((m_offset < m_size) ? "illegal value" : "unexpected end of data");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool JsonStreamReader::setError(const char *errorString)
+{
+    if (m_errorString == nullptr)
+    {
+        m_errorString = errorString;
+        m_errorOffset = m_offset;
+    }
+
+    return false;
+}
+
+} // namespace CppConfigFramework
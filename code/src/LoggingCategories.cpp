@@ -43,6 +43,7 @@ const QLoggingCategory ConfigItem("CppConfigFramework.ConfigItem");
 const QLoggingCategory ConfigNodePath("CppConfigFramework.ConfigNodePath");
 const QLoggingCategory ConfigParameterValidator("CppConfigFramework.ConfigParameterValidator");
 const QLoggingCategory ConfigReader("CppConfigFramework.ConfigReader");
+const QLoggingCategory ConfigSnapshot("CppConfigFramework.ConfigSnapshot");
 const QLoggingCategory ConfigWriter("CppConfigFramework.ConfigWriter");
 
 } // namespace LoggingCategory
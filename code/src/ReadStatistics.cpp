@@ -0,0 +1,90 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a structure for holding statistics of a configuration read procedure
+ */
+
+// Own header
+#include <CppConfigFramework/ReadStatistics.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+void ReadStatistics::reset()
+{
+    *this = ReadStatistics();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ReadStatistics::mergeCounters(const ReadStatistics &other)
+{
+    bytesParsed += other.bytesParsed;
+    nodesCreated += other.nodesCreated;
+    includeFiles += other.includeFiles;
+    includeCacheHits += other.includeCacheHits;
+    referenceResolutionCycles += other.referenceResolutionCycles;
+    referenceResolutionMaxCyclesUsed = std::max(referenceResolutionMaxCyclesUsed,
+                                                other.referenceResolutionMaxCyclesUsed);
+    referenceResolutionMaxCycles = std::max(referenceResolutionMaxCycles,
+                                            other.referenceResolutionMaxCycles);
+    clonesPerformed += other.clonesPerformed;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ReadStatistics::toJson() const
+{
+    return QJsonObject {
+        { QStringLiteral("parse_time_ns"), static_cast<double>(parseTime) },
+        { QStringLiteral("environment_variables_time_ns"),
+          static_cast<double>(environmentVariablesTime) },
+        { QStringLiteral("includes_time_ns"), static_cast<double>(includesTime) },
+        { QStringLiteral("config_time_ns"), static_cast<double>(configTime) },
+        { QStringLiteral("reference_resolution_time_ns"),
+          static_cast<double>(referenceResolutionTime) },
+        { QStringLiteral("apply_time_ns"), static_cast<double>(applyTime) },
+        { QStringLiteral("transform_time_ns"), static_cast<double>(transformTime) },
+        { QStringLiteral("total_time_ns"), static_cast<double>(totalTime) },
+        { QStringLiteral("bytes_parsed"), static_cast<double>(bytesParsed) },
+        { QStringLiteral("nodes_created"), nodesCreated },
+        { QStringLiteral("include_files"), includeFiles },
+        { QStringLiteral("include_cache_hits"), includeCacheHits },
+        { QStringLiteral("reference_resolution_cycles"),
+          static_cast<double>(referenceResolutionCycles) },
+        { QStringLiteral("reference_resolution_max_cycles_used"),
+          static_cast<double>(referenceResolutionMaxCyclesUsed) },
+        { QStringLiteral("reference_resolution_max_cycles"),
+          static_cast<double>(referenceResolutionMaxCycles) },
+        { QStringLiteral("clones_performed"), clonesPerformed }
+    };
+}
+
+} // namespace CppConfigFramework
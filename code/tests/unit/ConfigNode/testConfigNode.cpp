@@ -20,19 +20,26 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+#include <CppConfigFramework/ConfigNodeIndex.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 
 // Qt includes
 #include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
 #include <QtCore/QLine>
 #include <QtCore/QLineF>
 #include <QtCore/QRect>
 #include <QtCore/QRectF>
+#include <QtCore/QThread>
 #include <QtTest/QTest>
 
 // System includes
+#include <functional>
+#include <vector>
 
 // Forward declarations
 
@@ -54,6 +61,25 @@ using namespace CppConfigFramework;
 using ConfigNodePtr = std::shared_ptr<ConfigNode>;
 
 Q_DECLARE_METATYPE(ConfigNode::Type);
+
+//! Thread that executes the specified function
+class FunctionThread : public QThread
+{
+public:
+    explicit FunctionThread(std::function<void()> function)
+        : m_function(std::move(function))
+    {
+    }
+
+protected:
+    void run() override
+    {
+        m_function();
+    }
+
+private:
+    std::function<void()> m_function;
+};
 Q_DECLARE_METATYPE(ConfigNodePtr);
 
 class TestConfigNode : public QObject
@@ -84,17 +110,28 @@ private slots:
     void testMoveDerivedObject();
 
     void testCloneValue();
+    void testValueStorage();
+    void testValueStorage_data();
     void testCloneObject();
+    void testCloneObjectSharedMembers();
     void testCloneNodeReference();
     void testCloneDerivedObject();
 
     void testNodePath();
 
     void testObjectNode();
+    void testObjectNodeLookupByView();
     void testApplyObject();
+    void testApplyObjectMove();
+    void testLayeredObject();
+    void testUnresolvedCount();
 
     void testDerivedObjectNode();
 
+    void testNodeIndex();
+    void testNodeArena();
+    void testConcurrentReadAccess();
+
     void testEqualityOperatorsValue();
     void testEqualityOperatorsObject();
     void testEqualityOperatorsNodeReference();
@@ -455,6 +492,62 @@ void TestConfigNode::testCloneValue()
     QCOMPARE(clonedNode->toValue().value(), QJsonValue(456));
 }
 
+void TestConfigNode::testValueStorage()
+{
+    QFETCH(QJsonValue, value);
+
+    // Construction
+    ConfigValueNode node(value);
+    QCOMPARE(node.value(), value);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    // With Qt 6 the inline storage grows with QString so the node is not smaller than before
+    QVERIFY(sizeof(ConfigValueNode) < (sizeof(ConfigNode) + sizeof(QJsonValue)));
+#endif
+
+    // Cloning
+    auto clonedNode = node.clone();
+    QCOMPARE(clonedNode->toValue().value(), value);
+
+    // Setting the value from another node
+    ConfigValueNode otherNode(QStringLiteral("other value which is not short"));
+    otherNode.setValue(node);
+    QCOMPARE(otherNode.value(), value);
+    QCOMPARE(node.value(), value);
+
+    otherNode.setValue(QJsonValue(QJsonArray { 1, 2 }));
+    QCOMPARE(otherNode.value(), QJsonValue(QJsonArray { 1, 2 }));
+    otherNode.setValue(otherNode);
+    QCOMPARE(otherNode.value(), QJsonValue(QJsonArray { 1, 2 }));
+
+    // Moving
+    ConfigValueNode movedNode(std::move(node));
+    QCOMPARE(movedNode.value(), value);
+
+    otherNode = std::move(movedNode);
+    QCOMPARE(otherNode.value(), value);
+    QCOMPARE(clonedNode->toValue().value(), value);
+}
+
+void TestConfigNode::testValueStorage_data()
+{
+    QTest::addColumn<QJsonValue>("value");
+
+    QTest::newRow("Null") << QJsonValue(QJsonValue::Null);
+    QTest::newRow("Undefined") << QJsonValue(QJsonValue::Undefined);
+    QTest::newRow("Bool: true") << QJsonValue(true);
+    QTest::newRow("Bool: false") << QJsonValue(false);
+    QTest::newRow("Integer") << QJsonValue(8080);
+    QTest::newRow("Double") << QJsonValue(-1.5);
+    QTest::newRow("Empty string") << QJsonValue(QString());
+    QTest::newRow("Short string") << QJsonValue(QStringLiteral("host"));
+    QTest::newRow("Latin-1 string") << QJsonValue(QString::fromLatin1("caf\xE9"));
+    QTest::newRow("Max short string") << QJsonValue(QStringLiteral("abcdefghijklmn"));
+    QTest::newRow("Long string") << QJsonValue(QStringLiteral("abcdefghijklmno"));
+    QTest::newRow("Unicode string") << QJsonValue(QString::fromUtf8("\xC4\x8D\xC4\x87"));
+    QTest::newRow("Array") << QJsonValue(QJsonArray { 1, "a", true });
+    QTest::newRow("Object") << QJsonValue(QJsonObject { {"a", 1}, {"b", QJsonArray {2, 3}} });
+}
+
 void TestConfigNode::testCloneObject()
 {
     // Clone without parent
@@ -496,6 +589,66 @@ void TestConfigNode::testCloneObject()
     QCOMPARE(clonedNode->toObject().member("item2")->toValue().value(), QJsonValue("asd"));
 }
 
+void TestConfigNode::testCloneObjectSharedMembers()
+{
+    ConfigObjectNode node;
+    node.setMember("value", ConfigValueNode(1));
+    node.setMember("level1", ConfigObjectNode());
+    node.member("level1")->toObject().setMember("value", ConfigValueNode(2));
+    node.member("level1")->toObject().setMember("ref", ConfigNodeReference(ConfigNodePath("/a")));
+
+    // Clones share the members until they are accessed
+    auto clonedNode1 = node.clone();
+    auto clonedNode2 = node.clone();
+    QCOMPARE(clonedNode1->toObject().count(), 2);
+    QCOMPARE(clonedNode1->toObject().names(), QStringList({"level1", "value"}));
+    QVERIFY(clonedNode1->toObject().contains("level1"));
+    QCOMPARE(clonedNode1->toObject().unresolvedCount(), 1);
+
+    QVERIFY(clonedNode1->toObject() == node);
+    QVERIFY(clonedNode2->toObject() == node);
+
+    const auto *level1 = clonedNode1->nodeAtPath("/level1");
+    QVERIFY(level1 != nullptr);
+    QCOMPARE(level1->parent(), &clonedNode1->toObject());
+    QCOMPARE(level1->nodePath(), ConfigNodePath("/level1"));
+    QCOMPARE(level1->toObject().unresolvedCount(), 1);
+
+    // Modification of a clone does not change the original node or the other clones
+    clonedNode1->nodeAtPath("/level1/value")->toValue().setValue(20);
+    QCOMPARE(node.nodeAtPath("/level1/value")->toValue().value(), QJsonValue(2));
+    QCOMPARE(clonedNode2->nodeAtPath("/level1/value")->toValue().value(), QJsonValue(2));
+    QVERIFY(clonedNode1->toObject() != node);
+
+    // Modification of the original node is not visible in the existing clones, but it is in the new
+    // ones (also for modifications deeper in the subtree)
+    node.nodeAtPath("/level1/value")->toValue().setValue(3);
+    node.member("level1")->toObject().setMember("ref", ConfigValueNode(4));
+
+    auto clonedNode3 = node.clone();
+    QCOMPARE(clonedNode2->nodeAtPath("/level1/value")->toValue().value(), QJsonValue(2));
+    QCOMPARE(clonedNode3->nodeAtPath("/level1/value")->toValue().value(), QJsonValue(3));
+    QCOMPARE(clonedNode3->nodeAtPath("/level1/ref")->toValue().value(), QJsonValue(4));
+    QCOMPARE(clonedNode3->toObject().unresolvedCount(), 0);
+    QVERIFY(clonedNode3->toObject() == node);
+
+    // Clones of the clones
+    auto clonedNode4 = clonedNode3->clone();
+    clonedNode3->toObject().remove("value");
+    QVERIFY(clonedNode4->toObject() == node);
+    QCOMPARE(clonedNode3->toObject().count(), 1);
+
+    // Moving and removal of the members of a clone
+    auto clonedNode5 = node.clone();
+    ConfigObjectNode movedNode(std::move(clonedNode5->toObject()));
+    QCOMPARE(clonedNode5->toObject().count(), 0);
+    QVERIFY(movedNode == node);
+
+    movedNode.removeAll();
+    QCOMPARE(movedNode.count(), 0);
+    QCOMPARE(node.count(), 2);
+}
+
 void TestConfigNode::testCloneNodeReference()
 {
     // Clone without parent
@@ -608,6 +761,17 @@ void TestConfigNode::testNodePath()
     QCOMPARE(level3Item2->nodePath(), ConfigNodePath("/level1/level2/level3/item2"));
     QCOMPARE(rootNode.nodeAtPath(ConfigNodePath("/level1/level2/level3/item2")), level3Item2);
 
+    // Test node names
+    QCOMPARE(rootNode.nodeName(), QString());
+    QCOMPARE(level1->nodeName(), QString("level1"));
+    QCOMPARE(level3Item2->nodeName(), QString("item2"));
+    QCOMPARE(level3->toObject().name(*level3Item2), QString("item2"));
+    QCOMPARE(level2->toObject().name(*level3Item2), QString());
+
+    auto clonedLevel1 = level1->clone();
+    QCOMPARE(clonedLevel1->nodeAtPath("level2/level3/item1")->nodePath(),
+             ConfigNodePath("/level2/level3/item1"));
+
     // Test absolute paths on non-root items
     QCOMPARE(level3Item1->nodeAtPath(ConfigNodePath::ROOT_PATH), &rootNode);
     QCOMPARE(level3Item2->nodeAtPath(ConfigNodePath::ROOT_PATH), &rootNode);
@@ -705,10 +869,72 @@ void TestConfigNode::testObjectNode()
     QCOMPARE(object.name(*object.member("item1")), QString("item1"));
     QCOMPARE(object.name(object), QString());
 
+    // Take a member out of the node
+    object.member("item3")->toObject().setMember("ref", ConfigNodeReference(ConfigNodePath("/a")));
+    const ConfigNode *item3 = object.member("item3");
+    QCOMPARE(object.unresolvedCount(), 1);
+
+    auto takenNode = object.take("item3");
+    QVERIFY(takenNode.get() == item3);
+    QCOMPARE(takenNode->parent(), nullptr);
+    QCOMPARE(takenNode->nodePath(), ConfigNodePath(ConfigNodePath::ROOT_PATH_VALUE));
+    QCOMPARE(takenNode->toObject().unresolvedCount(), 1);
+    QCOMPARE(object.unresolvedCount(), 0);
+    QCOMPARE(object.count(), 1);
+    QVERIFY(!object.take("item9"));
+
     object.removeAll();
     QCOMPARE(object.count(), 0);
 }
 
+// Test: ConfigObjectNode lookups by QLatin1String and QStringView ---------------------------------
+
+void TestConfigNode::testObjectNodeLookupByView()
+{
+    ConfigObjectNode object;
+    const auto &objectConst = static_cast<const ConfigObjectNode&>(object);
+    QVERIFY(object.setMember(QLatin1String("item1"), ConfigValueNode(true)));
+    QVERIFY(object.setMember(QLatin1String("item2"), ConfigValueNode(123)));
+    QVERIFY(!object.setMember(QLatin1String("0item"), ConfigValueNode()));
+
+    QCOMPARE(object.count(), 2);
+    QCOMPARE(object.name(*object.member("item1")), QString("item1"));
+
+    // Lookups by a Latin-1 string
+    QVERIFY(object.contains(QLatin1String("item1")));
+    QVERIFY(!object.contains(QLatin1String("item9")));
+    QVERIFY(!object.contains(QLatin1String("item")));
+    QCOMPARE(object.member(QLatin1String("item2")), object.member("item2"));
+    QCOMPARE(objectConst.member(QLatin1String("item2")), object.member("item2"));
+    QCOMPARE(object.member(QLatin1String("item9")), nullptr);
+    QCOMPARE(objectConst.member(QLatin1String("item9")), nullptr);
+
+    // Replacing a member keeps the existing name
+    QVERIFY(object.setMember(QLatin1String("item2"), ConfigValueNode("str")));
+    QCOMPARE(object.count(), 2);
+    QCOMPARE(object.member("item2")->toValue().value(), QJsonValue("str"));
+    QCOMPARE(object.name(*object.member("item2")), QString("item2"));
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    // Lookups by a string view
+    const QString names = QStringLiteral("item1 item2 item9");
+    const QStringView item1 = QStringView(names).mid(0, 5);
+    const QStringView item9 = QStringView(names).mid(12, 5);
+
+    QVERIFY(object.contains(item1));
+    QVERIFY(!object.contains(item9));
+    QCOMPARE(object.member(item1), object.member("item1"));
+    QCOMPARE(objectConst.member(item1), object.member("item1"));
+    QCOMPARE(object.member(item9), nullptr);
+
+    QVERIFY(object.setMember(item9, ConfigValueNode(1.5)));
+    QCOMPARE(object.count(), 3);
+    QCOMPARE(object.member("item9")->toValue().value(), QJsonValue(1.5));
+    QCOMPARE(object.name(*object.member("item9")), QString("item9"));
+    QVERIFY(!object.setMember(QStringView(names).mid(0, 0), ConfigValueNode()));
+#endif
+}
+
 // Test: ConfigObjectNode::apply() method ----------------------------------------------------------
 
 void TestConfigNode::testApplyObject()
@@ -778,6 +1004,191 @@ void TestConfigNode::testApplyObject()
     QCOMPARE(node.nodeAtPath("level1/level2/value")->toValue().value(), QJsonValue(789));
 }
 
+// Test: ConfigObjectNode::apply() method with a moved node ---------------------------------------
+
+void TestConfigNode::testApplyObjectMove()
+{
+    auto createNode = []()
+    {
+        ConfigObjectNode node;
+        node.setMember("value", ConfigValueNode(111));
+        node.setMember("objectToValue", ConfigObjectNode());
+        node.setMember("level1", ConfigObjectNode());
+        node.member("level1")->toObject().setMember("value", ConfigValueNode(123));
+        return node;
+    };
+
+    auto createUpdate = []()
+    {
+        ConfigObjectNode update;
+        update.setMember("value", ConfigValueNode(222));
+        update.setMember("objectToValue", ConfigValueNode(1));
+        update.setMember("ref", ConfigNodeReference(ConfigNodePath("/value")));
+        update.setMember("level1", ConfigObjectNode());
+        update.member("level1")->toObject().setMember("value", ConfigValueNode(456));
+        update.member("level1")->toObject().setMember("level2", ConfigObjectNode());
+        update.nodeAtPath("level1/level2")->toObject().setMember("value", ConfigValueNode(789));
+        return update;
+    };
+
+    // Apply a copy and a moved update
+    ConfigObjectNode copiedNode = createNode();
+    const ConfigObjectNode copiedUpdate = createUpdate();
+    copiedNode.apply(copiedUpdate);
+
+    ConfigObjectNode movedNode = createNode();
+    ConfigObjectNode movedUpdate = createUpdate();
+    const ConfigNode *movedLevel2 = movedUpdate.nodeAtPath("level1/level2");
+    movedNode.apply(std::move(movedUpdate));
+
+    // Check the result
+    QVERIFY(movedNode == copiedNode);
+    QCOMPARE(movedNode.member("value")->toValue().value(), QJsonValue(222));
+    QVERIFY(movedNode.member("objectToValue")->isValue());
+    QCOMPARE(movedNode.nodeAtPath("level1/value")->toValue().value(), QJsonValue(456));
+    QCOMPARE(movedNode.unresolvedCount(), 1);
+    QCOMPARE(movedNode.member("level1")->toObject().unresolvedCount(), 0);
+
+    // The new members were moved (not cloned) to the node
+    QVERIFY(movedNode.nodeAtPath("level1/level2") == movedLevel2);
+    QVERIFY(movedLevel2->parent() == movedNode.member("level1"));
+    QCOMPARE(movedLevel2->nodePath(), ConfigNodePath("/level1/level2"));
+
+    // The moved update is left empty
+    QCOMPARE(movedUpdate.count(), 0);
+    QCOMPARE(movedUpdate.unresolvedCount(), 0);
+}
+
+// Test: ConfigObjectNode::createLayered() method --------------------------------------------------
+
+void TestConfigNode::testLayeredObject()
+{
+    ConfigObjectNode base1;
+    base1.setMember("value", ConfigValueNode(1));
+    base1.setMember("objectToValue", ConfigObjectNode());
+    base1.setMember("valueToObject", ConfigValueNode(2));
+    base1.setMember("level1", ConfigObjectNode());
+    base1.member("level1")->toObject().setMember("value1", ConfigValueNode(11));
+    base1.member("level1")->toObject().setMember("level2", ConfigObjectNode());
+    base1.nodeAtPath("level1/level2")->toObject().setMember("value", ConfigValueNode(111));
+
+    ConfigObjectNode base2;
+    base2.setMember("value", ConfigValueNode(3));
+    base2.setMember("objectToValue", ConfigValueNode(4));
+    base2.setMember("valueToObject", ConfigObjectNode());
+    base2.setMember("level1", ConfigObjectNode());
+    base2.member("level1")->toObject().setMember("value2", ConfigValueNode(22));
+    base2.member("level1")->toObject().setMember("level2", ConfigValueNode(222));
+
+    ConfigObjectNode overrides;
+    overrides.setMember("ref", ConfigNodeReference(ConfigNodePath("/value")));
+    overrides.setMember("level1", ConfigObjectNode());
+    overrides.member("level1")->toObject().setMember("level2", ConfigObjectNode());
+    overrides.nodeAtPath("level1/level2")->toObject().setMember("other", ConfigValueNode(333));
+
+    // The layered node must be the same as the node with all of the layers applied to it
+    ConfigObjectNode appliedNode;
+    appliedNode.apply(base1);
+    appliedNode.apply(base2);
+    appliedNode.apply(overrides);
+
+    auto layeredNode = ConfigObjectNode::createLayered({&base1, &base2, &overrides});
+    QCOMPARE(layeredNode->unresolvedCount(), 1);
+    QCOMPARE(layeredNode->count(), 5);
+    QVERIFY(*layeredNode == appliedNode);
+
+    // A member that hides an Object member of a lower layer must not be merged with it
+    QVERIFY(layeredNode->member("objectToValue")->isValue());
+    QVERIFY(layeredNode->member("valueToObject")->isObject());
+    QCOMPARE(layeredNode->member("valueToObject")->toObject().count(), 0);
+    QCOMPARE(layeredNode->nodeAtPath("level1/level2")->toObject().names(), QStringList({"other"}));
+    QCOMPARE(layeredNode->nodeAtPath("level1/level2/other")->nodePath(),
+             ConfigNodePath("/level1/level2/other"));
+
+    // The layered node does not change its layers
+    layeredNode->nodeAtPath("level1/value1")->toValue().setValue(0);
+    QCOMPARE(base1.nodeAtPath("level1/value1")->toValue().value(), QJsonValue(11));
+
+    // Later changes of the layers are not visible in the layered node
+    auto layeredNode2 = ConfigObjectNode::createLayered({&base1, &base2});
+    base2.member("level1")->toObject().setMember("value2", ConfigValueNode(0));
+    QCOMPARE(layeredNode2->nodeAtPath("level1/value2")->toValue().value(), QJsonValue(22));
+
+    // Clone of a layered node
+    auto layeredNode3 = ConfigObjectNode::createLayered({&base1, &overrides});
+    auto clonedNode = layeredNode3->clone();
+    QVERIFY(clonedNode->toObject() == *layeredNode3);
+    QCOMPARE(clonedNode->toObject().unresolvedCount(), 1);
+
+    // Flattened layered node
+    auto layeredNode4 = ConfigObjectNode::createLayered({&base1, &base2, &overrides});
+    layeredNode4->flatten();
+    QVERIFY(*layeredNode4 == appliedNode);
+
+    // Layers with unresolved nodes in the lower layers are applied immediately
+    auto layeredNode5 = ConfigObjectNode::createLayered({&overrides, &base1});
+    QCOMPARE(layeredNode5->unresolvedCount(), 1);
+    QCOMPARE(layeredNode5->count(), 5);
+
+    // No layers
+    QCOMPARE(ConfigObjectNode::createLayered({})->count(), 0);
+}
+
+// Test: ConfigObjectNode::unresolvedCount() method ------------------------------------------------
+
+void TestConfigNode::testUnresolvedCount()
+{
+    ConfigObjectNode node;
+    QCOMPARE(node.unresolvedCount(), 0);
+
+    // Add unresolved nodes to different levels
+    node.setMember("value", ConfigValueNode(1));
+    node.setMember("ref", ConfigNodeReference(ConfigNodePath("/value")));
+    QCOMPARE(node.unresolvedCount(), 1);
+
+    node.setMember("level1", ConfigObjectNode());
+    auto &level1 = node.member("level1")->toObject();
+    level1.setMember("level2", ConfigObjectNode());
+    auto &level2 = level1.member("level2")->toObject();
+
+    level2.setMember("derived", ConfigDerivedObjectNode({ConfigNodePath("/level1")},
+                                                        ConfigObjectNode()));
+    level2.setMember("ref", ConfigNodeReference(ConfigNodePath("/value")));
+    QCOMPARE(level2.unresolvedCount(), 2);
+    QCOMPARE(level1.unresolvedCount(), 2);
+    QCOMPARE(node.unresolvedCount(), 3);
+
+    // Replace unresolved nodes with resolved nodes
+    level2.setMember("ref", ConfigValueNode(1));
+    QCOMPARE(level2.unresolvedCount(), 1);
+    QCOMPARE(node.unresolvedCount(), 2);
+
+    node.setMember("ref", ConfigValueNode(1));
+    QCOMPARE(node.unresolvedCount(), 1);
+
+    // Copies keep the count
+    auto clonedNode = node.clone();
+    QCOMPARE(clonedNode->toObject().unresolvedCount(), 1);
+
+    ConfigObjectNode appliedNode;
+    appliedNode.setMember("level1", ConfigValueNode(1));
+    appliedNode.apply(node);
+    QCOMPARE(appliedNode.unresolvedCount(), 1);
+
+    // Remove the unresolved nodes
+    QVERIFY(level1.remove("level2"));
+    QCOMPARE(level1.unresolvedCount(), 0);
+    QCOMPARE(node.unresolvedCount(), 0);
+
+    appliedNode.member("level1")->toObject().removeAll();
+    QCOMPARE(appliedNode.unresolvedCount(), 0);
+
+    // Moving the members out of a node also moves the count
+    ConfigObjectNode movedNode(std::move(clonedNode->toObject()));
+    QCOMPARE(movedNode.unresolvedCount(), 1);
+    QCOMPARE(clonedNode->toObject().unresolvedCount(), 0);
+}
+
 // Test: DerivedObject node ------------------------------------------------------------------------
 
 void TestConfigNode::testDerivedObjectNode()
@@ -811,6 +1222,247 @@ void TestConfigNode::testDerivedObjectNode()
     QCOMPARE(derivedObject.config().member("b")->toValue().value(), QJsonValue("str"));
 }
 
+// Test: ConfigNodeIndex class ---------------------------------------------------------------------
+
+void TestConfigNode::testNodeIndex()
+{
+    ConfigObjectNode config;
+    config.setMember("value", ConfigValueNode(1));
+    config.setMember("level1", ConfigObjectNode());
+    config.member("level1")->toObject().setMember("value", ConfigValueNode(2));
+    config.member("level1")->toObject().setMember("level2", ConfigObjectNode());
+    config.nodeAtPath("/level1/level2")->toObject().setMember("value", ConfigValueNode(3));
+
+    ConfigNodeIndex index(config);
+    QVERIFY(&index.config() == &config);
+    QCOMPARE(index.count(), 1);
+
+    // Absolute node paths
+    QVERIFY(index.find(ConfigNodePath::ROOT_PATH) == &config);
+    QVERIFY(index.find(ConfigNodePath("/level1/level2/value")) ==
+            config.nodeAtPath("/level1/level2/value"));
+    QCOMPARE(index.count(), 4);
+
+    QVERIFY(index.find(ConfigNodePath("/level1/value")) == config.nodeAtPath("/level1/value"));
+    QVERIFY(index.find(ConfigNodePath("/level1/level2/../value")) ==
+            config.nodeAtPath("/level1/value"));
+    QCOMPARE(index.count(), 6);
+
+    // Repeated lookups are served from the index
+    QVERIFY(index.find(ConfigNodePath("/level1/level2/value")) ==
+            config.nodeAtPath("/level1/level2/value"));
+    QVERIFY(index.find(ConfigNodePath("/level1/level2/../value")) ==
+            config.nodeAtPath("/level1/value"));
+    QCOMPARE(index.count(), 6);
+
+    // Missing nodes
+    QVERIFY(index.find(ConfigNodePath("/missing/value")) == nullptr);
+    QVERIFY(index.find(ConfigNodePath("/value/member")) == nullptr);
+    QVERIFY(index.find(ConfigNodePath("/..")) == nullptr);
+    QVERIFY(index.find(ConfigNodePath("level1")) == nullptr);
+
+    // Nodes before a parent node reference must exist (same as for ConfigNode::nodeAtPath())
+    QVERIFY(config.nodeAtPath("/missing/../value") == nullptr);
+    QVERIFY(index.find(ConfigNodePath("/missing/../value")) == nullptr);
+    QVERIFY(index.find(ConfigNodePath("/level1/missing/../value")) == nullptr);
+    QVERIFY(index.find(ConfigNodePath("/level1/value/member/../../value")) == nullptr);
+    QVERIFY(index.find(ConfigNodePath("/level1/value/../level2")) ==
+            config.nodeAtPath("/level1/value/../level2"));
+    QVERIFY(index.find(ConfigNodePath("/level1/value")) == config.nodeAtPath("/level1/value"));
+
+    // Relative node paths
+    QVERIFY(index.find(ConfigNodePath("level2/value"), ConfigNodePath("/level1")) ==
+            config.nodeAtPath("/level1/level2/value"));
+    QVERIFY(index.find(ConfigNodePath("../value"), ConfigNodePath("/level1")) ==
+            config.nodeAtPath("/value"));
+    QVERIFY(index.find(ConfigNodePath("../value"), ConfigNodePath("/missing/level1")) == nullptr);
+    QVERIFY(index.find(ConfigNodePath("/value"), ConfigNodePath("/missing")) ==
+            config.nodeAtPath("/value"));
+}
+
+// Test: Node arena --------------------------------------------------------------------------------
+
+void TestConfigNode::testNodeArena()
+{
+    QVERIFY(ConfigNodeArena::active() == nullptr);
+
+    std::unique_ptr<ConfigObjectNode> config;
+    std::unique_ptr<ConfigNode> heapNode;
+
+    {
+        ConfigNodeArena arena(256);
+        QVERIFY(ConfigNodeArena::active() == &arena);
+        QCOMPARE(arena.blockCount(), 0);
+
+        config = std::make_unique<ConfigObjectNode>();
+
+        for (int i = 0; i < 20; i++)
+        {
+            config->setMember(QString("value%1").arg(i), std::make_unique<ConfigValueNode>(i));
+        }
+
+        QVERIFY(arena.blockCount() > 1);
+        QVERIFY(arena.allocatedSize() > 0);
+
+        // Nodes created in a heap scope are not allocated from the arena
+        const qint64 allocatedSize = arena.allocatedSize();
+
+        {
+            ConfigNodeArena::HeapScope heapScope;
+            QVERIFY(ConfigNodeArena::active() == nullptr);
+            heapNode = config->member("value0")->clone();
+        }
+
+        QCOMPARE(arena.allocatedSize(), allocatedSize);
+        QVERIFY(ConfigNodeArena::active() == &arena);
+
+        // Nested arena
+        {
+            ConfigNodeArena nestedArena;
+            QVERIFY(ConfigNodeArena::active() == &nestedArena);
+            config->setMember("nested", ConfigValueNode(100));
+            QCOMPARE(nestedArena.blockCount(), 1);
+        }
+
+        QVERIFY(ConfigNodeArena::active() == &arena);
+        QCOMPARE(arena.allocatedSize(), allocatedSize);
+    }
+
+    // The nodes outlive the arena object
+    QVERIFY(ConfigNodeArena::active() == nullptr);
+    QCOMPARE(config->count(), 21);
+    QCOMPARE(config->member("value19")->toValue().value(), QJsonValue(19));
+    QCOMPARE(config->member("nested")->toValue().value(), QJsonValue(100));
+    QCOMPARE(heapNode->toValue().value(), QJsonValue(0));
+
+    config->remove("value0");
+    QCOMPARE(config->count(), 20);
+    config.reset();
+    heapNode.reset();
+
+    // The arena's memory is freed together with the last node allocated from it
+    const int storageCount = ConfigNodeArena::storageCount();
+
+    {
+        ConfigNodeArena arena;
+        config = std::make_unique<ConfigObjectNode>();
+
+        for (int i = 0; i < 3000; i++)
+        {
+            config->setMember(QString("value%1").arg(i), std::make_unique<ConfigValueNode>(i));
+        }
+
+        heapNode = std::make_unique<ConfigValueNode>(0);
+    }
+
+    QCOMPARE(ConfigNodeArena::storageCount(), storageCount + 1);
+
+    config->remove("value0");
+    QCOMPARE(ConfigNodeArena::storageCount(), storageCount + 1);
+
+    // A single remaining node keeps the arena's memory alive
+    config.reset();
+    QCOMPARE(ConfigNodeArena::storageCount(), storageCount + 1);
+
+    heapNode.reset();
+    QCOMPARE(ConfigNodeArena::storageCount(), storageCount);
+}
+
+// Test: Concurrent read access -------------------------------------------------------------------
+
+void TestConfigNode::testConcurrentReadAccess()
+{
+    ConfigObjectNode base;
+
+    for (int i = 0; i < 10; i++)
+    {
+        ConfigObjectNode level1;
+
+        for (int j = 0; j < 10; j++)
+        {
+            level1.setMember(QString("value%1").arg(j), ConfigValueNode(i * 10 + j));
+        }
+
+        base.setMember(QString("level%1").arg(i), level1);
+    }
+
+    ConfigObjectNode overrides;
+    overrides.setMember("level0", ConfigObjectNode());
+    overrides.member("level0")->toObject().setMember("value0", ConfigValueNode(-1));
+
+    // A layered node (or a clone) creates its members when they are accessed so it needs to be
+    // flattened before it is read from multiple threads
+    auto layeredNode = ConfigObjectNode::createLayered({&base, &overrides});
+    layeredNode->flatten();
+
+    const ConfigObjectNode &config = *layeredNode;
+    std::vector<int> failures(4, 0);
+    std::vector<std::unique_ptr<FunctionThread>> threads;
+
+    for (size_t threadIndex = 0U; threadIndex < failures.size(); threadIndex++)
+    {
+        int *threadFailures = &failures[threadIndex];
+
+        threads.push_back(std::make_unique<FunctionThread>([&config, threadFailures]()
+        {
+            for (int i = 0; i < 10; i++)
+            {
+                for (int j = 0; j < 10; j++)
+                {
+                    const ConfigNodePath path(QString("/level%1/value%2").arg(i).arg(j));
+                    const ConfigNode *node = config.nodeAtPath(path);
+                    const int expectedValue = ((i == 0) && (j == 0)) ? -1 : (i * 10 + j);
+
+                    if ((node == nullptr) ||
+                        (node->nodePath() != path) ||
+                        (node->toValue().value() != QJsonValue(expectedValue)))
+                    {
+                        (*threadFailures)++;
+                    }
+                }
+            }
+        }));
+        threads.back()->start();
+    }
+
+    for (auto &thread : threads)
+    {
+        QVERIFY(thread->wait());
+    }
+
+    for (const int threadFailures : failures)
+    {
+        QCOMPARE(threadFailures, 0);
+    }
+
+    // The first clone creates the shared members so after it the node can be cloned from multiple
+    // threads at the same time
+    const auto firstClone = config.clone();
+    QVERIFY(firstClone->toObject() == config);
+
+    std::vector<std::unique_ptr<ConfigNode>> clones(failures.size());
+    threads.clear();
+
+    for (auto &clone : clones)
+    {
+        threads.push_back(std::make_unique<FunctionThread>([&config, &clone]()
+        {
+            clone = config.clone();
+        }));
+        threads.back()->start();
+    }
+
+    for (auto &thread : threads)
+    {
+        QVERIFY(thread->wait());
+    }
+
+    for (const auto &clone : clones)
+    {
+        QVERIFY(clone->toObject() == config);
+    }
+}
+
 // Test: Equality operators for Value node ---------------------------------------------------------
 
 void TestConfigNode::testEqualityOperatorsValue()
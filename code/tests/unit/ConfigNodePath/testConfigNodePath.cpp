@@ -83,6 +83,10 @@ private slots:
 
     void testAppendNodePath();
     void testAppendNodePath_data();
+
+    void testValidateNodeName();
+    void testValidateNodeName_data();
+    void testValidateNodeNames();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -387,9 +391,36 @@ void TestConfigNodePath::testNodeNames()
     QStringList nodeNames = { "a", "b", "c" };
     QCOMPARE(nodePath.nodeNames(), nodeNames);
 
+    // Node names are split only once and they are shared with copies of the node path
+    QCOMPARE(&nodePath.nodeNames(), &nodePath.nodeNames());
+    QCOMPARE(&ConfigNodePath(nodePath).nodeNames(), &nodePath.nodeNames());
+
     nodePath.setPath("d/e/f");
     nodeNames = QStringList { "d", "e", "f" };
     QCOMPARE(nodePath.nodeNames(), nodeNames);
+
+    // Node names are kept up to date when the node path is modified
+    nodePath.append("g");
+    nodeNames = QStringList { "d", "e", "f", "g" };
+    QCOMPARE(nodePath.nodeNames(), nodeNames);
+
+    nodePath.append(ConfigNodePath("../h"));
+    nodeNames = QStringList { "d", "e", "f", "g", "..", "h" };
+    QCOMPARE(nodePath.nodeNames(), nodeNames);
+    QVERIFY(nodePath.hasUnresolvedReferences());
+
+    QVERIFY(nodePath.resolveReferences());
+    nodeNames = QStringList { "d", "e", "f", "h" };
+    QCOMPARE(nodePath.nodeNames(), nodeNames);
+    QVERIFY(!nodePath.hasUnresolvedReferences());
+
+    // Root and empty node paths have no node names
+    QVERIFY(ConfigNodePath::ROOT_PATH.nodeNames().isEmpty());
+    QVERIFY(ConfigNodePath().nodeNames().isEmpty());
+
+    nodePath = ConfigNodePath::ROOT_PATH;
+    nodePath.append("a");
+    QCOMPARE(nodePath.nodeNames(), QStringList { "a" });
 }
 
 // Test: toAbsolute() method -----------------------------------------------------------------------
@@ -511,6 +542,55 @@ void TestConfigNodePath::testAppendNodePath_data()
     QTest::newRow("Empty path") << "" << "aaa/bbb" << "";
 }
 
+// Test: validateNodeName() method -----------------------------------------------------------------
+
+void TestConfigNodePath::testValidateNodeName()
+{
+    QFETCH(QString, name);
+    QFETCH(bool, expectedResult);
+
+    QCOMPARE(ConfigNodePath::validateNodeName(name), expectedResult);
+    QCOMPARE(ConfigNodePath::validateNodeName(name.constData(), name.size()), expectedResult);
+
+    const QByteArray latin1Name = name.toLatin1();
+    QCOMPARE(ConfigNodePath::validateNodeName(QLatin1String(latin1Name)), expectedResult);
+}
+
+void TestConfigNodePath::testValidateNodeName_data()
+{
+    QTest::addColumn<QString>("name");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("Single letter") << "a" << true;
+    QTest::newRow("Letters") << "aBcD" << true;
+    QTest::newRow("Letters and digits") << "a1b2" << true;
+    QTest::newRow("Underscore") << "a_b_" << true;
+
+    QTest::newRow("Empty") << "" << false;
+    QTest::newRow("Starts with a digit") << "0a" << false;
+    QTest::newRow("Starts with an underscore") << "_a" << false;
+    QTest::newRow("Parent reference") << ".." << false;
+    QTest::newRow("Separator") << "a/b" << false;
+    QTest::newRow("Space") << "a b" << false;
+    QTest::newRow("Non-ASCII letter") << QString::fromUtf8("a\xc3\xa4") << false;
+}
+
+// Test: validateNodeNames() method ----------------------------------------------------------------
+
+void TestConfigNodePath::testValidateNodeNames()
+{
+    QVERIFY(ConfigNodePath::validateNodeNames({}));
+    QVERIFY(ConfigNodePath::validateNodeNames({ "a", "b1", "c_" }));
+
+    QVERIFY(!ConfigNodePath::validateNodeNames({ "a", "", "c" }));
+    QVERIFY(!ConfigNodePath::validateNodeNames({ "a", "b", ".." }));
+
+    // Only the valid part of the string is validated
+    const QString name = QStringLiteral("abc/def");
+    QVERIFY(ConfigNodePath::validateNodeName(name.constData(), 3));
+    QVERIFY(!ConfigNodePath::validateNodeName(name.constData(), 4));
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestConfigNodePath)
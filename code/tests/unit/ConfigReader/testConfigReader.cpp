@@ -19,12 +19,18 @@
  */
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigNameTable.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigReader.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 
 // Qt includes
 #include <QtCore/QDebug>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QThreadPool>
 #include <QtTest/QTest>
 
 // System includes
@@ -54,6 +60,9 @@ private slots:
     void testReadValidConfig();
     void testReadConfigWithNodeReference();
     void testReadConfigWithDerivedObject();
+    void testReadConfigWithDependentReferences();
+    void testReadConfigWithRelativeReferences();
+    void testReadConfigWithLongReferenceChain();
     void testReadConfigWithIncludes();
     void testReadConfigWithIncludesAndEnv();
     void testReadConfigWithOnlyIncludes();
@@ -65,6 +74,18 @@ private slots:
     void testReadInvalidConfigFile_data();
     void testCurrentDirectoryEnvironmentVariable();
     void testReadConfigNullEnvironmentVariables();
+    void testReadStatistics();
+    void testStreamingParser();
+    void testStreamingParser_data();
+    void testMemoryMappedFile();
+    void testIncludeCache();
+    void testParallelIncludes();
+    void testParallelIncludes_data();
+    void testPartialParsing();
+    void testPartialParsing_data();
+    void testArenaAllocation();
+    void testArenaAllocationWithIncludeCache();
+    void testNameTable();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -326,6 +347,161 @@ void TestConfigReader::testReadConfigWithDerivedObject()
     }
 }
 
+// Test: read a config file with references that depend on each other -----------------------------
+
+void TestConfigReader::testReadConfigWithDependentReferences()
+{
+    // Read config file (the references are resolved in the order of their dependencies so a single
+    // cycle is enough)
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithDependentReferences.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    configReader.setReferenceResolutionMaxCycles(1U);
+
+    ReadStatistics statistics;
+    auto config = configReader.read(configFilePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables,
+                                    &statistics);
+    QVERIFY(config);
+    QCOMPARE(statistics.referenceResolutionCycles, 1U);
+
+    // Check "/node1"
+    {
+        const auto *node1 = config->nodeAtPath("/node1");
+        QVERIFY(node1 != nullptr);
+        QVERIFY(node1->isValue());
+        QCOMPARE(node1->toValue().value(), QJsonValue(3));
+    }
+
+    // Check "/node2"
+    {
+        const auto *node2 = config->nodeAtPath("/node2");
+        QVERIFY(node2 != nullptr);
+        QVERIFY(node2->isObject());
+        QCOMPARE(node2->toObject().count(), 3);
+        QCOMPARE(node2->toObject().member("value")->toValue().value(), QJsonValue(3));
+        QCOMPARE(node2->toObject().member("other")->toValue().value(), QJsonValue("str"));
+        QCOMPARE(node2->toObject().member("extra")->toValue().value(), QJsonValue(2));
+    }
+
+    // Check "/node3"
+    {
+        const auto *node3 = config->nodeAtPath("/node3");
+        QVERIFY(node3 != nullptr);
+        QVERIFY(node3->isObject());
+        QCOMPARE(node3->toObject().count(), 2);
+        QCOMPARE(node3->toObject().member("value")->toValue().value(), QJsonValue(3));
+        QCOMPARE(node3->toObject().member("other")->toValue().value(), QJsonValue("str"));
+    }
+}
+
+// Test: read a config file with relative references inside of referenced nodes --------------------
+
+void TestConfigReader::testReadConfigWithRelativeReferences()
+{
+    // Read config file (the relative references inside of a referenced node are resolved relative
+    // to where they are defined before the node is copied, regardless of the order of the members)
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithRelativeReferences.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    auto config = configReader.read(configFilePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->unresolvedCount(), 0);
+
+    // Check "/target"
+    {
+        const auto *target = config->nodeAtPath("/target");
+        QVERIFY(target != nullptr);
+        QVERIFY(target->isObject());
+        QCOMPARE(target->toObject().count(), 2);
+        QCOMPARE(target->toObject().member("value")->toValue().value(), QJsonValue(1));
+        QCOMPARE(target->toObject().member("other")->toValue().value(), QJsonValue("str"));
+    }
+
+    // Check "/a/copy" (member that is ordered before the referenced node)
+    {
+        const auto *copy = config->nodeAtPath("/a/copy");
+        QVERIFY(copy != nullptr);
+        QVERIFY(copy->isObject());
+        QCOMPARE(copy->toObject().count(), 2);
+        QCOMPARE(copy->toObject().member("value")->toValue().value(), QJsonValue(1));
+        QCOMPARE(copy->toObject().member("other")->toValue().value(), QJsonValue("str"));
+    }
+
+    // Check "/zz/copy" (member that is ordered after the referenced node)
+    {
+        const auto *copy = config->nodeAtPath("/zz/copy");
+        QVERIFY(copy != nullptr);
+        QVERIFY(copy->isObject());
+        QCOMPARE(copy->toObject().count(), 2);
+        QCOMPARE(copy->toObject().member("value")->toValue().value(), QJsonValue(1));
+        QCOMPARE(copy->toObject().member("other")->toValue().value(), QJsonValue("str"));
+    }
+
+    // Check "/c/derived" (the overrides are resolved relative to the derived object)
+    {
+        const auto *derived = config->nodeAtPath("/c/derived");
+        QVERIFY(derived != nullptr);
+        QVERIFY(derived->isObject());
+        QCOMPARE(derived->toObject().count(), 3);
+        QCOMPARE(derived->toObject().member("value")->toValue().value(), QJsonValue(1));
+        QCOMPARE(derived->toObject().member("other")->toValue().value(), QJsonValue("str"));
+        QCOMPARE(derived->toObject().member("own")->toValue().value(), QJsonValue(4));
+    }
+}
+
+// Test: read a config with a long chain of references ---------------------------------------------
+
+void TestConfigReader::testReadConfigWithLongReferenceChain()
+{
+    // Create a config where each node references the next one (the chain is long enough to exhaust
+    // the call stack if each link would be resolved recursively)
+    const int chainLength = 20000;
+    QByteArray configData("{ \"config\": { ");
+
+    for (int i = 0; i < chainLength; i++)
+    {
+        configData.append(QStringLiteral("\"&node%1\": \"/node%2\", ").arg(i).arg(i + 1).toUtf8());
+    }
+
+    configData.append(QStringLiteral("\"node%1\": 42 } }").arg(chainLength).toUtf8());
+
+    const QJsonDocument configDocument = QJsonDocument::fromJson(configData);
+    QVERIFY(configDocument.isObject());
+
+    // Read config
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    auto config = configReader.read(configDocument.object(),
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->count(), chainLength + 1);
+    QCOMPARE(config->unresolvedCount(), 0);
+
+    for (const QString &nodePath : { QStringLiteral("/node0"), QStringLiteral("/node12345") })
+    {
+        const auto *node = config->nodeAtPath(nodePath);
+        QVERIFY(node != nullptr);
+        QVERIFY(node->isValue());
+        QCOMPARE(node->toValue().value(), QJsonValue(42));
+    }
+}
+
 // Test: read a config file with includes ----------------------------------------------------------
 
 void TestConfigReader::testReadConfigWithIncludes()
@@ -638,17 +814,21 @@ void TestConfigReader::testReadInvalidConfigFile()
 {
     QFETCH(QString, filePath);
 
-    // Read config file
-    auto environmentVariables = EnvironmentVariables::loadFromProcess();
-    ConfigReader configReader;
-
-    auto config = configReader.read(filePath,
-                                    QDir::current(),
-                                    ConfigNodePath::ROOT_PATH,
-                                    ConfigNodePath::ROOT_PATH,
-                                    {},
-                                    &environmentVariables);
-    QVERIFY(!config);
+    // Read config file (with and without the streaming parser)
+    for (const bool streamingParserEnabled : { false, true })
+    {
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+        ConfigReader configReader;
+        configReader.setStreamingParserEnabled(streamingParserEnabled);
+
+        auto config = configReader.read(filePath,
+                                        QDir::current(),
+                                        ConfigNodePath::ROOT_PATH,
+                                        ConfigNodePath::ROOT_PATH,
+                                        {},
+                                        &environmentVariables);
+        QVERIFY(!config);
+    }
 }
 
 void TestConfigReader::testReadInvalidConfigFile_data()
@@ -696,6 +876,8 @@ void TestConfigReader::testReadInvalidConfigFile_data()
     QTest::newRow("ConfigInvalidReferenceType") << ":/TestData/ConfigInvalidReferenceType.json";
     QTest::newRow("ConfigInvalidSubObjectNode") << ":/TestData/ConfigInvalidSubObjectNode.json";
     QTest::newRow("ConfigUnresolvedReference") << ":/TestData/ConfigUnresolvedReference.json";
+    QTest::newRow("ConfigReferenceCycle1") << ":/TestData/ConfigReferenceCycle1.json";
+    QTest::newRow("ConfigReferenceCycle2") << ":/TestData/ConfigReferenceCycle2.json";
     QTest::newRow("ConfigUnresolvableExternalConfigReferences")
             << ":/TestData/ConfigUnresolvableExternalConfigReferences.json";
     QTest::newRow("ConfigUnresolvedFilePath") << ":/TestData/ConfigUnresolvedFilePath.json";
@@ -759,6 +941,721 @@ void TestConfigReader::testReadConfigNullEnvironmentVariables()
     QVERIFY(!config);
 }
 
+// Test: read statistics --------------------------------------------------------------------------
+
+void TestConfigReader::testReadStatistics()
+{
+    // Read config file
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithIncludes.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    configReader.setReferenceResolutionMaxCycles(10U);
+
+    ReadStatistics statistics;
+    statistics.includeFiles = 100;
+
+    auto config = configReader.read(configFilePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables,
+                                    &statistics);
+    QVERIFY(config);
+
+    // Check counters ("Include1.json" is included twice, directly and from "Include2.json")
+    const qint64 expectedBytesParsed =
+            QFileInfo(configFilePath).size() +
+            (2 * QFileInfo(QStringLiteral(":/TestData/Include1.json")).size()) +
+            QFileInfo(QStringLiteral(":/TestData/Include2.json")).size() +
+            QFileInfo(QStringLiteral(":/TestData/Include3.json")).size();
+
+    QCOMPARE(statistics.bytesParsed, expectedBytesParsed);
+    QCOMPARE(statistics.nodesCreated, 19);
+    QCOMPARE(statistics.includeFiles, 4);
+    QCOMPARE(statistics.referenceResolutionCycles, 5U);
+    QCOMPARE(statistics.referenceResolutionMaxCyclesUsed, 1U);
+    QCOMPARE(statistics.referenceResolutionMaxCycles, 10U);
+    QVERIFY(statistics.clonesPerformed > 0);
+
+    // Check times
+    QVERIFY(statistics.totalTime > 0);
+    QVERIFY(statistics.totalTime >= (statistics.parseTime +
+                                     statistics.environmentVariablesTime +
+                                     statistics.includesTime +
+                                     statistics.configTime +
+                                     statistics.referenceResolutionTime +
+                                     statistics.applyTime +
+                                     statistics.transformTime));
+
+    // Check JSON conversion
+    const QJsonObject statisticsObject = statistics.toJson();
+    QCOMPARE(statisticsObject.value(QStringLiteral("include_files")).toInt(), 4);
+    QCOMPARE(statisticsObject.value(QStringLiteral("nodes_created")).toInt(), 19);
+}
+
+// Test: streaming parser --------------------------------------------------------------------------
+
+void TestConfigReader::testStreamingParser()
+{
+    QFETCH(QString, filePath);
+    QFETCH(bool, valid);
+
+    // Read config file without the streaming parser
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+    QVERIFY(!configReader.isStreamingParserEnabled());
+
+    auto config = configReader.read(filePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QCOMPARE(static_cast<bool>(config), valid);
+
+    // Read config file with the streaming parser
+    auto streamingEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    streamingEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader streamingConfigReader;
+    streamingConfigReader.setStreamingParserEnabled(true);
+    QVERIFY(streamingConfigReader.isStreamingParserEnabled());
+
+    ReadStatistics statistics;
+    auto streamedConfig = streamingConfigReader.read(filePath,
+                                                     QDir::current(),
+                                                     ConfigNodePath::ROOT_PATH,
+                                                     ConfigNodePath::ROOT_PATH,
+                                                     {},
+                                                     &streamingEnvironmentVariables,
+                                                     &statistics);
+    QCOMPARE(static_cast<bool>(streamedConfig), valid);
+
+    // Both configs must be the same
+    if (valid)
+    {
+        QVERIFY(statistics.bytesParsed > 0);
+        QVERIFY(*streamedConfig == *config);
+    }
+}
+
+void TestConfigReader::testStreamingParser_data()
+{
+    QTest::addColumn<QString>("filePath");
+    QTest::addColumn<bool>("valid");
+
+    QTest::newRow("ValidConfig") << ":/TestData/ValidConfig.json" << true;
+    QTest::newRow("ConfigWithNodeReferences") << ":/TestData/ConfigWithNodeReferences.json" << true;
+    QTest::newRow("ConfigWithDerivedObjects") << ":/TestData/ConfigWithDerivedObjects.json" << true;
+    QTest::newRow("ConfigWithDependentReferences")
+            << ":/TestData/ConfigWithDependentReferences.json" << true;
+    QTest::newRow("ConfigWithIncludes") << ":/TestData/ConfigWithIncludes.json" << true;
+    QTest::newRow("ConfigWithIncludesAndEnv") << ":/TestData/ConfigWithIncludesAndEnv.json" << true;
+    QTest::newRow("ConfigWithOnlyIncludes") << ":/TestData/ConfigWithOnlyIncludes.json" << true;
+
+    // The same member set with different decorators must give the same result with both parsers
+    // (the key order in the file must not matter)
+    QTest::newRow("ConfigDuplicateDecoratedMember")
+            << ":/TestData/ConfigDuplicateDecoratedMember.json" << true;
+}
+
+// Test: memory-mapped file -----------------------------------------------------------------------
+
+void TestConfigReader::testMemoryMappedFile()
+{
+    // Copy the config file to the file system so that it can be memory-mapped
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    const QString configFilePath = QDir(directory.path()).absoluteFilePath("ValidConfig.json");
+    QVERIFY(QFile::copy(":/TestData/ValidConfig.json", configFilePath));
+
+    // Read config file without memory-mapping
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    QVERIFY(!configReader.isMemoryMappingEnabled());
+
+    auto config = configReader.read(configFilePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+
+    // Read config file with memory-mapping (with and without the streaming parser)
+    for (const bool streamingParserEnabled : { false, true })
+    {
+        auto mappedEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+        ConfigReader mappedConfigReader;
+        mappedConfigReader.setMemoryMappingEnabled(true);
+        mappedConfigReader.setStreamingParserEnabled(streamingParserEnabled);
+        QVERIFY(mappedConfigReader.isMemoryMappingEnabled());
+
+        auto mappedConfig = mappedConfigReader.read(configFilePath,
+                                                    QDir::current(),
+                                                    ConfigNodePath::ROOT_PATH,
+                                                    ConfigNodePath::ROOT_PATH,
+                                                    {},
+                                                    &mappedEnvironmentVariables);
+        QVERIFY(mappedConfig);
+        QVERIFY(*mappedConfig == *config);
+    }
+}
+
+// Test: include cache -----------------------------------------------------------------------------
+
+void TestConfigReader::testIncludeCache()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    auto writeFile = [&directory](const QString &fileName, const QByteArray &contents)
+    {
+        QFile file(QDir(directory.path()).absoluteFilePath(fileName));
+
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            return false;
+        }
+
+        return (file.write(contents) == contents.size());
+    };
+
+    // The same file is included twice (the second include sees the environment variable set by the
+    // first one)
+    QVERIFY(writeFile("Base.json",
+                      R"({
+                             "environment_variables": { "BASE_VALUE": "base" },
+                             "config": { "$value": "${TEST_CACHE_VALUE}" }
+                         })"));
+    QVERIFY(writeFile("Main.json",
+                      R"({
+                             "includes":
+                             [
+                                 { "file_path": "Base.json" },
+                                 { "file_path": "${CPPCONFIGFRAMEWORK_CURRENT_DIR}/Base.json" }
+                             ],
+                             "config": { "$base_value": "${BASE_VALUE}" }
+                         })"));
+    const QString mainFilePath = QDir(directory.path()).absoluteFilePath("Main.json");
+
+    auto cache = std::make_shared<ConfigIncludeCache>();
+    ConfigReader configReader;
+    QVERIFY(!configReader.includeCache());
+    configReader.setIncludeCache(cache);
+    QVERIFY(configReader.includeCache() == cache);
+
+    auto readMainFile = [&](const QString &testValue, ReadStatistics *statistics)
+    {
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+        environmentVariables.setValue("TEST_CACHE_VALUE", testValue);
+
+        return configReader.read(mainFilePath,
+                                 QDir::current(),
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables,
+                                 statistics);
+    };
+
+    // First read stores both variants of the include
+    ReadStatistics statistics;
+    auto config = readMainFile("1", &statistics);
+    QVERIFY(config);
+    QCOMPARE(config->member("value")->toValue().value(), QJsonValue("1"));
+    QCOMPARE(config->member("base_value")->toValue().value(), QJsonValue("base"));
+    QCOMPARE(statistics.includeFiles, 2);
+    QCOMPARE(statistics.includeCacheHits, 0);
+    QCOMPARE(cache->count(), 2);
+
+    // Second read takes both includes from the cache (including their environment variables)
+    auto cachedConfig = readMainFile("1", &statistics);
+    QVERIFY(cachedConfig);
+    QVERIFY(*cachedConfig == *config);
+    QCOMPARE(statistics.includeCacheHits, 2);
+    QCOMPARE(cache->count(), 2);
+
+    // A change of a used environment variable needs a new read of the include
+    cachedConfig = readMainFile("2", &statistics);
+    QVERIFY(cachedConfig);
+    QCOMPARE(cachedConfig->member("value")->toValue().value(), QJsonValue("2"));
+    QCOMPARE(statistics.includeCacheHits, 0);
+    QCOMPARE(cache->count(), 4);
+
+    // A change of the included file needs a new read of the include
+    QVERIFY(writeFile("Base.json",
+                      R"({
+                             "environment_variables": { "BASE_VALUE": "changed base" },
+                             "config": { "$value": "changed ${TEST_CACHE_VALUE}" }
+                         })"));
+
+    cachedConfig = readMainFile("1", &statistics);
+    QVERIFY(cachedConfig);
+    QCOMPARE(cachedConfig->member("value")->toValue().value(), QJsonValue("changed 1"));
+    QCOMPARE(cachedConfig->member("base_value")->toValue().value(), QJsonValue("changed base"));
+    QCOMPARE(statistics.includeCacheHits, 0);
+
+    // Result must be the same as without the cache
+    ConfigReader uncachedConfigReader;
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_CACHE_VALUE", "1");
+
+    auto uncachedConfig = uncachedConfigReader.read(mainFilePath,
+                                                    QDir::current(),
+                                                    ConfigNodePath::ROOT_PATH,
+                                                    ConfigNodePath::ROOT_PATH,
+                                                    {},
+                                                    &environmentVariables);
+    QVERIFY(uncachedConfig);
+    QVERIFY(*cachedConfig == *uncachedConfig);
+
+    cache->clear();
+    QCOMPARE(cache->count(), 0);
+}
+
+// Test: parallel includes ------------------------------------------------------------------------
+
+void TestConfigReader::testParallelIncludes()
+{
+    QFETCH(bool, streamingParserEnabled);
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    auto writeFile = [&directory](const QString &fileName, const QByteArray &contents)
+    {
+        QFile file(QDir(directory.path()).absoluteFilePath(fileName));
+
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            return false;
+        }
+
+        return (file.write(contents) == contents.size());
+    };
+
+    // The second include depends on an environment variable set by the first include and it
+    // references a node from the first include, the third include has its own includes
+    QVERIFY(writeFile("First.json",
+                      R"({
+                             "environment_variables": { "SECOND_FILE_NAME": "Second" },
+                             "config": { "first": { "value": 1 }, "shared": "first" }
+                         })"));
+    QVERIFY(writeFile("Second.json",
+                      R"({
+                             "config":
+                             {
+                                 "second": { "value": 2 },
+                                 "shared": "second",
+                                 "&first_value": "/first/value"
+                             }
+                         })"));
+    QVERIFY(writeFile("Third.json",
+                      R"({
+                             "includes":
+                             [
+                                 { "file_path": "First.json", "destination_node": "/third" },
+                                 { "file_path": "Second.json", "destination_node": "/third" }
+                             ],
+                             "config": { "third": { "value": 3 } }
+                         })"));
+    QVERIFY(writeFile("Main.json",
+                      R"({
+                             "includes":
+                             [
+                                 { "file_path": "First.json" },
+                                 { "file_path": "${SECOND_FILE_NAME}.json" },
+                                 { "file_path": "Third.json" }
+                             ],
+                             "config": { "$second_file_name": "${SECOND_FILE_NAME}" }
+                         })"));
+    const QString mainFilePath = QDir(directory.path()).absoluteFilePath("Main.json");
+
+    auto readMainFile = [&mainFilePath](const ConfigReader &configReader)
+    {
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+
+        return configReader.read(mainFilePath,
+                                 QDir::current(),
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables);
+    };
+
+    // Read the includes one after another
+    ConfigReader sequentialConfigReader;
+    sequentialConfigReader.setStreamingParserEnabled(streamingParserEnabled);
+    QVERIFY(!sequentialConfigReader.isParallelIncludesEnabled());
+
+    auto sequentialConfig = readMainFile(sequentialConfigReader);
+    QVERIFY(sequentialConfig);
+    QCOMPARE(sequentialConfig->member("shared")->toValue().value(), QJsonValue("second"));
+    QCOMPARE(sequentialConfig->member("first_value")->toValue().value(), QJsonValue(1));
+    QCOMPARE(sequentialConfig->member("second_file_name")->toValue().value(),
+             QJsonValue("Second"));
+    QVERIFY(sequentialConfig->nodeAtPath("/third/third/value") != nullptr);
+
+    // Read the includes in parallel (in the global and in a dedicated thread pool)
+    ConfigReader parallelConfigReader;
+    parallelConfigReader.setStreamingParserEnabled(streamingParserEnabled);
+    parallelConfigReader.setParallelIncludesEnabled(true);
+    QVERIFY(parallelConfigReader.isParallelIncludesEnabled());
+    QVERIFY(parallelConfigReader.includeThreadPool() == nullptr);
+
+    auto parallelConfig = readMainFile(parallelConfigReader);
+    QVERIFY(parallelConfig);
+    QVERIFY(*parallelConfig == *sequentialConfig);
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(1);
+    parallelConfigReader.setIncludeThreadPool(&threadPool);
+    QVERIFY(parallelConfigReader.includeThreadPool() == &threadPool);
+
+    parallelConfig = readMainFile(parallelConfigReader);
+    QVERIFY(parallelConfig);
+    QVERIFY(*parallelConfig == *sequentialConfig);
+
+    // A failed include must be reported in the same way
+    QVERIFY(QFile::remove(QDir(directory.path()).absoluteFilePath("Second.json")));
+    QVERIFY(!readMainFile(sequentialConfigReader));
+    QVERIFY(!readMainFile(parallelConfigReader));
+    threadPool.waitForDone();
+}
+
+void TestConfigReader::testParallelIncludes_data()
+{
+    QTest::addColumn<bool>("streamingParserEnabled");
+
+    QTest::newRow("QJsonDocument") << false;
+    QTest::newRow("Streaming parser") << true;
+}
+
+// Test: partial parsing ---------------------------------------------------------------------------
+
+void TestConfigReader::testPartialParsing()
+{
+    QFETCH(bool, streamingParserEnabled);
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    const QString filePath = QDir(directory.path()).absoluteFilePath("Catalog.json");
+
+    auto writeFile = [&filePath](const QByteArray &contents)
+    {
+        QFile file(filePath);
+
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            return false;
+        }
+
+        return (file.write(contents) == contents.size());
+    };
+
+    auto readFile = [&filePath](const ConfigReader &configReader, ReadStatistics *statistics)
+    {
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+
+        return configReader.read(filePath,
+                                 QDir::current(),
+                                 ConfigNodePath("/catalog/needed"),
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables,
+                                 statistics);
+    };
+
+    // The source node references nodes outside of its subtree (also indirectly, through a base of a
+    // DerivedObject node and from its overrides). The skipped members are read only once they are
+    // referenced, also when the same member is set with different decorators.
+    QVERIFY(writeFile(R"({
+                             "config":
+                             {
+                                 "catalog":
+                                 {
+                                     "needed":
+                                     {
+                                         "value": 1,
+                                         "&ref": "/shared/item",
+                                         "&derived":
+                                         {
+                                             "base": "../base",
+                                             "config": { "&local": "/other/x" }
+                                         }
+                                     },
+                                     "base": { "a": 1 },
+                                     "unused": { "items": [1, 2, 3], "&ref": "/deep" }
+                                 },
+                                 "shared": { "item": { "&inner": "../../deep/value" }, "b": 2 },
+                                 "deep": { "value": 42, "other": { "c": 3 } },
+                                 "#deep": { "value": 0 },
+                                 "other": { "x": 3, "y": 4 }
+                             }
+                         })"));
+
+    ConfigReader fullConfigReader;
+    fullConfigReader.setStreamingParserEnabled(streamingParserEnabled);
+    QVERIFY(!fullConfigReader.isPartialParsingEnabled());
+
+    ReadStatistics fullStatistics;
+    auto fullConfig = readFile(fullConfigReader, &fullStatistics);
+    QVERIFY(fullConfig);
+
+    ConfigReader partialConfigReader;
+    partialConfigReader.setStreamingParserEnabled(streamingParserEnabled);
+    partialConfigReader.setPartialParsingEnabled(true);
+    QVERIFY(partialConfigReader.isPartialParsingEnabled());
+
+    ReadStatistics partialStatistics;
+    auto partialConfig = readFile(partialConfigReader, &partialStatistics);
+    QVERIFY(partialConfig);
+
+    // Check the result
+    QVERIFY(*partialConfig == *fullConfig);
+    QCOMPARE(partialConfig->names(), QStringList({"derived", "ref", "value"}));
+    QCOMPARE(partialConfig->nodeAtPath("/ref/inner")->toValue().value(), QJsonValue(42));
+    QCOMPARE(partialConfig->nodeAtPath("/derived/a")->toValue().value(), QJsonValue(1));
+    QCOMPARE(partialConfig->nodeAtPath("/derived/local")->toValue().value(), QJsonValue(3));
+
+    // Only the needed nodes were created
+    QVERIFY(partialStatistics.nodesCreated < fullStatistics.nodesCreated);
+
+    // Invalid content in the skipped nodes is accepted
+    QVERIFY(writeFile(R"({
+                             "config":
+                             {
+                                 "catalog": { "needed": { "value": 1 } },
+                                 "unused": { "&ref": "/missing", "nested": { "invalid/name": 1 } }
+                             }
+                         })"));
+
+    QVERIFY(!readFile(fullConfigReader, nullptr));
+
+    partialConfig = readFile(partialConfigReader, nullptr);
+    QVERIFY(partialConfig);
+    QCOMPARE(partialConfig->names(), QStringList({"value"}));
+}
+
+void TestConfigReader::testPartialParsing_data()
+{
+    QTest::addColumn<bool>("streamingParserEnabled");
+
+    QTest::newRow("QJsonDocument") << false;
+    QTest::newRow("Streaming parser") << true;
+}
+
+// Test: arena allocation --------------------------------------------------------------------------
+
+void TestConfigReader::testArenaAllocation()
+{
+    const QString configFilePath(QStringLiteral(":/TestData/ValidConfig.json"));
+
+    auto readConfigFile = [&configFilePath](const ConfigReader &configReader)
+    {
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+
+        return configReader.read(configFilePath,
+                                 QDir::current(),
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables);
+    };
+
+    ConfigReader heapConfigReader;
+    QVERIFY(!heapConfigReader.isArenaAllocationEnabled());
+    const auto heapConfig = readConfigFile(heapConfigReader);
+    QVERIFY(heapConfig);
+
+    ConfigReader arenaConfigReader;
+    arenaConfigReader.setArenaAllocationEnabled(true);
+    QVERIFY(arenaConfigReader.isArenaAllocationEnabled());
+
+    // The arena is active only during the read procedure
+    auto arenaConfig = readConfigFile(arenaConfigReader);
+    QVERIFY(arenaConfig);
+    QVERIFY(ConfigNodeArena::active() == nullptr);
+    QVERIFY(*arenaConfig == *heapConfig);
+    arenaConfig.reset();
+
+    // An already active arena is used instead of creating a new one
+    {
+        ConfigNodeArena arena;
+        arenaConfig = readConfigFile(arenaConfigReader);
+        QVERIFY(arenaConfig);
+        QVERIFY(ConfigNodeArena::active() == &arena);
+        QVERIFY(arena.allocatedSize() > 0);
+    }
+
+    QVERIFY(*arenaConfig == *heapConfig);
+}
+
+// Test: arena allocation with the include cache ---------------------------------------------------
+
+void TestConfigReader::testArenaAllocationWithIncludeCache()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    auto writeFile = [&directory](const QString &fileName, const QByteArray &contents)
+    {
+        QFile file(QDir(directory.path()).absoluteFilePath(fileName));
+
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            return false;
+        }
+
+        return (file.write(contents) == contents.size());
+    };
+
+    // The include contains nested Object nodes, references and derived objects so that the read
+    // procedure clones and layers its nodes
+    QVERIFY(writeFile("Base.json",
+                      R"({
+                             "config":
+                             {
+                                 "object":
+                                 {
+                                     "value": 1,
+                                     "nested": { "text": "a long text value" }
+                                 },
+                                 "&reference": "/object",
+                                 "&derived": { "base": "/object", "config": { "value": 2 } }
+                             }
+                         })"));
+    QVERIFY(writeFile("Main.json",
+                      R"({
+                             "includes": [ { "file_path": "Base.json" } ],
+                             "config": { "main": true }
+                         })"));
+    const QString mainFilePath = QDir(directory.path()).absoluteFilePath("Main.json");
+
+    auto cache = std::make_shared<ConfigIncludeCache>();
+    ConfigReader configReader;
+    configReader.setIncludeCache(cache);
+    configReader.setArenaAllocationEnabled(true);
+
+    auto readMainFile = [&configReader, &mainFilePath](ReadStatistics *statistics)
+    {
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+
+        return configReader.read(mainFilePath,
+                                 QDir::current(),
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables,
+                                 statistics);
+    };
+
+    const int storageCount = ConfigNodeArena::storageCount();
+
+    // The first read stores the include in the cache, the second one takes it from the cache
+    ReadStatistics statistics;
+    auto config = readMainFile(&statistics);
+    QVERIFY(config);
+    QCOMPARE(cache->count(), 1);
+    QCOMPARE(ConfigNodeArena::storageCount(), storageCount + 1);
+
+    auto cachedConfig = readMainFile(&statistics);
+    QVERIFY(cachedConfig);
+    QCOMPARE(statistics.includeCacheHits, 1);
+    QVERIFY(*cachedConfig == *config);
+    QCOMPARE(ConfigNodeArena::storageCount(), storageCount + 2);
+
+    // The cached include must not keep the memory of the arenas alive
+    config.reset();
+    cachedConfig.reset();
+    QCOMPARE(cache->count(), 1);
+    QCOMPARE(ConfigNodeArena::storageCount(), storageCount);
+
+    // The cache is still usable after the arenas are freed
+    config = readMainFile(&statistics);
+    QVERIFY(config);
+    QCOMPARE(statistics.includeCacheHits, 1);
+    QCOMPARE(config->nodeAtPath("/derived/value")->toValue().value(), QJsonValue(2));
+    QCOMPARE(config->nodeAtPath("/reference/nested/text")->toValue().value(),
+             QJsonValue("a long text value"));
+    config.reset();
+    QCOMPARE(ConfigNodeArena::storageCount(), storageCount);
+}
+
+// Test: name table --------------------------------------------------------------------------------
+
+void TestConfigReader::testNameTable()
+{
+    // Interning
+    ConfigNameTable nameTable;
+    QCOMPARE(nameTable.count(), 0);
+
+    const QString name1 = nameTable.intern(QString("host"));
+    const QString name2 = nameTable.intern(QString("ho") + QString("st"));
+    QCOMPARE(name1, QStringLiteral("host"));
+    QVERIFY(name1.constData() == name2.constData());
+    QCOMPARE(nameTable.count(), 1);
+
+    nameTable.intern(QString("port"));
+    QCOMPARE(nameTable.count(), 2);
+    QCOMPARE(nameTable.removeUnused(), 1);
+    QCOMPARE(nameTable.count(), 1);
+
+    nameTable.clear();
+    QCOMPARE(nameTable.count(), 0);
+
+    // Reading
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    const QString filePath = QDir(directory.path()).absoluteFilePath("Config.json");
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write(R"({
+                     "config":
+                     {
+                         "device1": { "host": "a", "port": 1 },
+                         "device2": { "host": "b", "port": 2, "&alias": "../device1/host" }
+                     }
+                 })");
+    file.close();
+
+    for (const bool streamingParserEnabled : { false, true })
+    {
+        auto sharedNameTable = std::make_shared<ConfigNameTable>();
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+
+        ConfigReader configReader;
+        QVERIFY(!configReader.nameTable());
+        configReader.setStreamingParserEnabled(streamingParserEnabled);
+        configReader.setNameTable(sharedNameTable);
+        QVERIFY(configReader.nameTable() == sharedNameTable);
+
+        const auto config = configReader.read(filePath,
+                                              QDir(directory.path()),
+                                              ConfigNodePath::ROOT_PATH,
+                                              ConfigNodePath::ROOT_PATH,
+                                              {},
+                                              &environmentVariables);
+        QVERIFY(config);
+        QCOMPARE(sharedNameTable->count(), 5);
+
+        const QStringList names1 = config->member("device1")->toObject().names();
+        const QStringList names2 = config->member("device2")->toObject().names();
+        QCOMPARE(names1, QStringList({"host", "port"}));
+        QCOMPARE(names2, QStringList({"alias", "host", "port"}));
+        QVERIFY(names1.at(0).constData() == names2.at(1).constData());
+        QVERIFY(names1.at(1).constData() == names2.at(2).constData());
+
+        // The names are still used by the configuration nodes
+        QCOMPARE(sharedNameTable->removeUnused(), 0);
+    }
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestConfigReader)
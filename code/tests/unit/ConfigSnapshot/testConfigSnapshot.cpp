@@ -0,0 +1,294 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigSnapshot class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigSnapshot.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestSnapshotConfigItem : public ConfigItem
+{
+public:
+    double number = 0.0;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadRequiredConfigParameter(&number, "number", config);
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigParameter(number, "number", config);
+    }
+};
+
+class TestConfigSnapshot : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testSnapshotData();
+    void testSnapshotFile();
+    void testInvalidSnapshotData();
+    void testUnsupportedNodes();
+    void testLoadConfigItem();
+
+private:
+    static std::unique_ptr<ConfigObjectNode> createConfig();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigSnapshot::initTestCase()
+{
+}
+
+void TestConfigSnapshot::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigSnapshot::init()
+{
+}
+
+void TestConfigSnapshot::cleanup()
+{
+}
+
+// Test: snapshot data -----------------------------------------------------------------------------
+
+void TestConfigSnapshot::testSnapshotData()
+{
+    const auto config = createConfig();
+    const QByteArray data = ConfigSnapshot::serialize(*config);
+    QVERIFY(!data.isEmpty());
+
+    ConfigSnapshot snapshot;
+    QVERIFY(snapshot.open(data));
+    QVERIFY(snapshot.isOpen());
+
+    // Check root node
+    const auto root = snapshot.rootNode();
+    QVERIFY(root.isValid());
+    QVERIFY(root.isRoot());
+    QVERIFY(root.isObject());
+    QCOMPARE(root.nodePath(), ConfigNodePath(ConfigNodePath::ROOT_PATH_VALUE));
+    QCOMPARE(root.count(), 3);
+    QCOMPARE(root.names(), QStringList({"bool", "object", "text"}));
+    QVERIFY(!root.parent().isValid());
+
+    // Check member lookup
+    QVERIFY(root.contains("bool"));
+    QVERIFY(!root.contains("missing"));
+    QCOMPARE(root.member("bool").value(), QJsonValue(true));
+    QCOMPARE(root.member("text").value(), QJsonValue(QStringLiteral("text")));
+
+    const auto object = root.member("object");
+    QVERIFY(object.isObject());
+    QCOMPARE(object.nodeName(), QStringLiteral("object"));
+    QCOMPARE(object.nodePath(), ConfigNodePath("/object"));
+    QCOMPARE(object.member("null").value(), QJsonValue(QJsonValue::Null));
+    QCOMPARE(object.member("number").value(), QJsonValue(1.5));
+    QCOMPARE(object.member("array").value(), QJsonValue(QJsonArray {1, "a", true}));
+    QCOMPARE(object.member("json_object").value(),
+             QJsonValue(QJsonObject { {"a", 1}, {"b", QJsonArray {2, 3}} }));
+    QVERIFY(!object.member("number").isObject());
+    QVERIFY(!object.member("number").member("x").isValid());
+
+    // Check node paths
+    QCOMPARE(root.nodeAtPath(ConfigNodePath("/object/number")).value(), QJsonValue(1.5));
+    QCOMPARE(object.nodeAtPath(ConfigNodePath("number")).value(), QJsonValue(1.5));
+    QCOMPARE(object.nodeAtPath(ConfigNodePath("../text")).value(),
+             QJsonValue(QStringLiteral("text")));
+    QVERIFY(object.nodeAtPath(ConfigNodePath("/")).isRoot());
+    QVERIFY(!root.nodeAtPath(ConfigNodePath("/object/missing")).isValid());
+    QVERIFY(!root.nodeAtPath(ConfigNodePath("..")).isValid());
+
+    // Check conversion to configuration nodes
+    const auto loadedConfig = snapshot.toConfigNode();
+    QVERIFY(loadedConfig);
+    QVERIFY(*loadedConfig == *config);
+
+    // Check closing of the snapshot
+    snapshot.close();
+    QVERIFY(!snapshot.isOpen());
+    QVERIFY(!snapshot.rootNode().isValid());
+}
+
+// Test: snapshot file -----------------------------------------------------------------------------
+
+void TestConfigSnapshot::testSnapshotFile()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QString filePath = tempDir.filePath("config.snapshot");
+
+    const auto config = createConfig();
+    QVERIFY(ConfigSnapshot::write(*config, filePath));
+
+    ConfigSnapshot snapshot;
+    QVERIFY(snapshot.open(filePath));
+    QCOMPARE(snapshot.rootNode().nodeAtPath(ConfigNodePath("/object/number")).value(),
+             QJsonValue(1.5));
+
+    const auto loadedConfig = snapshot.toConfigNode();
+    QVERIFY(loadedConfig);
+    QVERIFY(*loadedConfig == *config);
+
+    // Check a missing file
+    QVERIFY(!snapshot.open(tempDir.filePath("missing.snapshot")));
+    QVERIFY(!snapshot.isOpen());
+}
+
+// Test: invalid snapshot data ---------------------------------------------------------------------
+
+void TestConfigSnapshot::testInvalidSnapshotData()
+{
+    const QByteArray data = ConfigSnapshot::serialize(*createConfig());
+    QVERIFY(!data.isEmpty());
+
+    ConfigSnapshot snapshot;
+
+    // Empty data
+    QVERIFY(!snapshot.open(QByteArray()));
+
+    // Truncated data
+    QVERIFY(!snapshot.open(data.left(data.size() - 8)));
+    QVERIFY(!snapshot.open(data.left(16)));
+
+    // Invalid magic value
+    QByteArray invalidData = data;
+    invalidData[0] = 'X';
+    QVERIFY(!snapshot.open(invalidData));
+
+    // Invalid version
+    invalidData = data;
+    invalidData[8] = static_cast<char>(99);
+    QVERIFY(!snapshot.open(invalidData));
+
+    // Invalid node count
+    invalidData = data;
+    invalidData[15] = static_cast<char>(0x7F);
+    QVERIFY(!snapshot.open(invalidData));
+
+    QVERIFY(!snapshot.isOpen());
+}
+
+// Test: unsupported nodes -------------------------------------------------------------------------
+
+void TestConfigSnapshot::testUnsupportedNodes()
+{
+    // Node reference
+    ConfigObjectNode config;
+    config.setMember("reference", std::make_unique<ConfigNodeReference>(ConfigNodePath("/a")));
+    QVERIFY(ConfigSnapshot::serialize(config).isEmpty());
+
+    // Undefined value
+    config.remove("reference");
+    config.setMember("undefined",
+                     std::make_unique<ConfigValueNode>(QJsonValue(QJsonValue::Undefined)));
+    QVERIFY(ConfigSnapshot::serialize(config).isEmpty());
+
+    // Empty configuration
+    ConfigObjectNode emptyConfig;
+    const QByteArray data = ConfigSnapshot::serialize(emptyConfig);
+    QVERIFY(!data.isEmpty());
+
+    ConfigSnapshot snapshot;
+    QVERIFY(snapshot.open(data));
+    QCOMPARE(snapshot.rootNode().count(), 0);
+}
+
+// Test: load a configuration item from a subtree of the snapshot ----------------------------------
+
+void TestConfigSnapshot::testLoadConfigItem()
+{
+    const auto config = createConfig();
+    const QByteArray data = ConfigSnapshot::serialize(*config);
+    QVERIFY(!data.isEmpty());
+
+    ConfigSnapshot snapshot;
+    QVERIFY(snapshot.open(data));
+
+    // Only the subtree needed by the configuration item is converted to configuration nodes
+    const auto node = snapshot.rootNode().nodeAtPath(ConfigNodePath("/object")).toConfigNode();
+    QVERIFY(node);
+    QVERIFY(node->isObject());
+    QVERIFY(node->isRoot());
+    QCOMPARE(node->toObject().count(), 4);
+
+    TestSnapshotConfigItem item;
+    QVERIFY(item.loadConfig(node->toObject()));
+    QCOMPARE(item.number, 1.5);
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigSnapshot::createConfig()
+{
+    auto object = std::make_unique<ConfigObjectNode>();
+    object->setMember("null", std::make_unique<ConfigValueNode>(QJsonValue(QJsonValue::Null)));
+    object->setMember("number", std::make_unique<ConfigValueNode>(1.5));
+    object->setMember("array", std::make_unique<ConfigValueNode>(QJsonArray {1, "a", true}));
+    object->setMember("json_object",
+                      std::make_unique<ConfigValueNode>(
+                          QJsonObject { {"a", 1}, {"b", QJsonArray {2, 3}} }));
+
+    auto config = std::make_unique<ConfigObjectNode>();
+    config->setMember("text", std::make_unique<ConfigValueNode>(QStringLiteral("text")));
+    config->setMember("bool", std::make_unique<ConfigValueNode>(true));
+    config->setMember("object", std::move(object));
+    return config;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigSnapshot)
+#include "testConfigSnapshot.moc"
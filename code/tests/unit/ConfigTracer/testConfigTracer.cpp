@@ -0,0 +1,262 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigTracer class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigTracer.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test config classes -----------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfig : public ConfigItem
+{
+public:
+    int param = 0;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadRequiredConfigParameter(&param, "param", config);
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigParameter(param, "param", config);
+    }
+};
+
+// Helper functions --------------------------------------------------------------------------------
+
+static QStringList eventNames(const QJsonDocument &trace)
+{
+    QStringList names;
+
+    for (const auto &event : trace.object().value(QStringLiteral("traceEvents")).toArray())
+    {
+        names.append(event.toObject().value(QStringLiteral("name")).toString());
+    }
+
+    return names;
+}
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestConfigTracer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testDisabled();
+    void testNestedSpans();
+    void testReadConfig();
+    void testLoadConfig();
+    void testWriteChromeTrace();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigTracer::initTestCase()
+{
+}
+
+void TestConfigTracer::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigTracer::init()
+{
+    ConfigTracer::instance()->clear();
+}
+
+void TestConfigTracer::cleanup()
+{
+    ConfigTracer::instance()->setEnabled(false);
+    ConfigTracer::instance()->clear();
+}
+
+// Test: tracing is disabled -----------------------------------------------------------------------
+
+void TestConfigTracer::testDisabled()
+{
+    auto *tracer = ConfigTracer::instance();
+    QVERIFY(!tracer->isEnabled());
+
+    {
+        ConfigTraceSpan span(QStringLiteral("test"), QStringLiteral("span"));
+        QVERIFY(!span.isActive());
+    }
+
+    tracer->addCompleteEvent(QStringLiteral("test"), QStringLiteral("event"), 0, 1);
+    QCOMPARE(tracer->eventCount(), 0);
+}
+
+// Test: nested spans ------------------------------------------------------------------------------
+
+void TestConfigTracer::testNestedSpans()
+{
+    auto *tracer = ConfigTracer::instance();
+    tracer->setEnabled(true);
+
+    {
+        ConfigTraceSpan outerSpan(QStringLiteral("test"), QStringLiteral("outer"));
+        QVERIFY(outerSpan.isActive());
+
+        {
+            ConfigTraceSpan innerSpan(QStringLiteral("test"), QStringLiteral("inner"));
+            innerSpan.setName(QStringLiteral("inner: renamed"));
+            innerSpan.setArgument(QStringLiteral("value"), 123);
+        }
+    }
+
+    QCOMPARE(tracer->eventCount(), 2);
+
+    const auto events = tracer->toChromeTrace().object().value("traceEvents").toArray();
+    QCOMPARE(events.size(), 2);
+
+    // Inner span ends first
+    const auto innerEvent = events.at(0).toObject();
+    const auto outerEvent = events.at(1).toObject();
+
+    QCOMPARE(innerEvent.value("name").toString(), QString("inner: renamed"));
+    QCOMPARE(innerEvent.value("cat").toString(), QString("test"));
+    QCOMPARE(innerEvent.value("ph").toString(), QString("X"));
+    QCOMPARE(innerEvent.value("args").toObject().value("value").toInt(), 123);
+    QVERIFY(innerEvent.contains("pid"));
+    QVERIFY(innerEvent.contains("tid"));
+
+    QCOMPARE(outerEvent.value("name").toString(), QString("outer"));
+    QVERIFY(!outerEvent.contains("args"));
+
+    // Inner span must be within the outer span
+    const double innerStart = innerEvent.value("ts").toDouble();
+    const double innerEnd = innerStart + innerEvent.value("dur").toDouble();
+    const double outerStart = outerEvent.value("ts").toDouble();
+    const double outerEnd = outerStart + outerEvent.value("dur").toDouble();
+
+    QVERIFY(outerStart <= innerStart);
+    QVERIFY(innerEnd <= outerEnd);
+}
+
+// Test: spans recorded while reading a config -----------------------------------------------------
+
+void TestConfigTracer::testReadConfig()
+{
+    ConfigTracer::instance()->setEnabled(true);
+
+    const QJsonObject configObject {
+        { "config", QJsonObject {
+              { "base", QJsonObject { { "value", 1 } } },
+              { "&derived", QJsonObject { { "base", "/base" } } }
+          }
+        }
+    };
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    auto config = configReader.read(configObject,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+
+    const QStringList names = eventNames(ConfigTracer::instance()->toChromeTrace());
+    QVERIFY(names.contains("Resolve references"));
+    QVERIFY(names.contains("Derived object: /derived"));
+}
+
+// Test: spans recorded while loading a config structure -------------------------------------------
+
+void TestConfigTracer::testLoadConfig()
+{
+    ConfigTracer::instance()->setEnabled(true);
+
+    ConfigObjectNode config;
+    ConfigObjectNode node;
+    node.setMember("param", std::make_unique<ConfigValueNode>(1));
+    config.setMember("item", node);
+
+    TestConfig testConfig;
+    QVERIFY(testConfig.loadConfig("item", config));
+    QCOMPARE(testConfig.param, 1);
+
+    const QStringList names = eventNames(ConfigTracer::instance()->toChromeTrace());
+    QVERIFY(names.contains("Load config: /item"));
+}
+
+// Test: write trace to a file ---------------------------------------------------------------------
+
+void TestConfigTracer::testWriteChromeTrace()
+{
+    auto *tracer = ConfigTracer::instance();
+    tracer->setEnabled(true);
+
+    {
+        ConfigTraceSpan span(QStringLiteral("test"), QStringLiteral("span"));
+    }
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    const QString filePath = directory.filePath("trace.json");
+    QVERIFY(tracer->writeChromeTrace(filePath));
+
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+
+    QJsonParseError error {};
+    const auto trace = QJsonDocument::fromJson(file.readAll(), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QCOMPARE(eventNames(trace), QStringList { "span" });
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigTracer)
+#include "testConfigTracer.moc"
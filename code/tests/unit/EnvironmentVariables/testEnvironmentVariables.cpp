@@ -57,6 +57,8 @@ private slots:
 
     void testExpandText();
     void testExpandText_data();
+
+    void testAccessRecording();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -172,6 +174,38 @@ void TestEnvironmentVariables::testExpandText_data()
     QTest::newRow("non-existent var") << "${TEST_VAR_DOES_NOT_EXIST}" << QString();
 }
 
+// Test: access recording -------------------------------------------------------------------------
+
+void TestEnvironmentVariables::testAccessRecording()
+{
+    EnvironmentVariables environmentVariables;
+    environmentVariables.setValue("TEST1", "value");
+    environmentVariables.setValue("TEST2", "${TEST1}");
+
+    // Nothing is recorded without an active recording
+    QCOMPARE(environmentVariables.stopAccessRecording().readNames, QSet<QString>());
+
+    environmentVariables.startAccessRecording();
+    QCOMPARE(environmentVariables.expandText("${TEST2}"), QString("value"));
+
+    // Nested recording
+    environmentVariables.startAccessRecording();
+    environmentVariables.setValue("TEST3", "nested");
+    QCOMPARE(environmentVariables.value("TEST3"), QString("nested"));
+    QVERIFY(!environmentVariables.contains("TEST4"));
+
+    const auto nestedRecord = environmentVariables.stopAccessRecording();
+    QCOMPARE(nestedRecord.readNames, QSet<QString>({"TEST4"}));
+    QCOMPARE(nestedRecord.writtenNames, QSet<QString>({"TEST3"}));
+
+    // Values set during the recording are not inputs of the recorded procedure
+    QCOMPARE(environmentVariables.value("TEST3"), QString("nested"));
+
+    const auto record = environmentVariables.stopAccessRecording();
+    QCOMPARE(record.readNames, QSet<QString>({"TEST1", "TEST2", "TEST4"}));
+    QCOMPARE(record.writtenNames, QSet<QString>({"TEST3"}));
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestEnvironmentVariables)
@@ -0,0 +1,277 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for JsonStreamReader class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/JsonStreamReader.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+Q_DECLARE_METATYPE(QJsonValue::Type)
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestJsonStreamReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testReadValue();
+    void testReadValue_data();
+
+    void testReadInvalidData();
+    void testReadInvalidData_data();
+
+    void testReadMembers();
+    void testSetOffset();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestJsonStreamReader::initTestCase()
+{
+}
+
+void TestJsonStreamReader::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestJsonStreamReader::init()
+{
+}
+
+void TestJsonStreamReader::cleanup()
+{
+}
+
+// Test: readValue() method ------------------------------------------------------------------------
+
+void TestJsonStreamReader::testReadValue()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QJsonValue::Type, expectedType);
+
+    // Use QJsonDocument as a reference (the value is wrapped in an array because QJsonDocument
+    // supports only arrays and objects at the top level)
+    QJsonParseError parseError {};
+    const auto doc = QJsonDocument::fromJson("[" + json + "]", &parseError);
+    QCOMPARE(parseError.error, QJsonParseError::NoError);
+    const QJsonValue expectedValue = doc.array().at(0);
+
+    JsonStreamReader reader(json);
+    QCOMPARE(reader.peekType(), expectedType);
+
+    const QJsonValue value = reader.readValue();
+    QVERIFY(!reader.hasError());
+    QVERIFY(reader.readEnd());
+    QCOMPARE(value, expectedValue);
+}
+
+void TestJsonStreamReader::testReadValue_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QJsonValue::Type>("expectedType");
+
+    QTest::newRow("null") << QByteArray("null") << QJsonValue::Null;
+    QTest::newRow("true") << QByteArray("true") << QJsonValue::Bool;
+    QTest::newRow("false") << QByteArray(" false ") << QJsonValue::Bool;
+    QTest::newRow("zero") << QByteArray("0") << QJsonValue::Double;
+    QTest::newRow("integer") << QByteArray("123") << QJsonValue::Double;
+    QTest::newRow("negative") << QByteArray("-1.5") << QJsonValue::Double;
+    QTest::newRow("exponent") << QByteArray("2.5e-3") << QJsonValue::Double;
+    QTest::newRow("string") << QByteArray("\"text\"") << QJsonValue::String;
+    QTest::newRow("empty string") << QByteArray("\"\"") << QJsonValue::String;
+    QTest::newRow("escapes") << QByteArray("\"a\\\"b\\\\c\\/d\\n\\t\"") << QJsonValue::String;
+    QTest::newRow("unicode escape") << QByteArray("\"\\u00e9\\u20AC\"") << QJsonValue::String;
+    QTest::newRow("surrogate pair") << QByteArray("\"\\ud83d\\ude00\"") << QJsonValue::String;
+    QTest::newRow("UTF-8") << QByteArray("\"\xc3\xa9\xe2\x82\xac\"") << QJsonValue::String;
+    QTest::newRow("UTF-8 4-byte") << QByteArray("\"a\xf0\x9f\x98\x80" "b\"") << QJsonValue::String;
+    QTest::newRow("long number")
+            << QByteArray("0.000000000000000000000000000000000000000000000000000000000000000000001")
+            << QJsonValue::Double;
+    QTest::newRow("empty array") << QByteArray("[ ]") << QJsonValue::Array;
+    QTest::newRow("array") << QByteArray("[1, \"a\", [true, null], {\"b\": 2}]")
+                           << QJsonValue::Array;
+    QTest::newRow("empty object") << QByteArray("{}") << QJsonValue::Object;
+    QTest::newRow("object") << QByteArray("{\"a\": {\"b\": [1, 2]}, \"c\": \"d\"}")
+                            << QJsonValue::Object;
+}
+
+// Test: reading of invalid data -------------------------------------------------------------------
+
+void TestJsonStreamReader::testReadInvalidData()
+{
+    QFETCH(QByteArray, json);
+
+    JsonStreamReader reader(json);
+    const QJsonValue value = reader.readValue();
+
+    if (!value.isUndefined())
+    {
+        // Value was read but the rest of the data must be invalid
+        QVERIFY(!reader.readEnd());
+    }
+
+    QVERIFY(reader.hasError());
+    QVERIFY(!reader.errorString().isEmpty());
+    QVERIFY(reader.errorOffset() >= 0);
+}
+
+void TestJsonStreamReader::testReadInvalidData_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("empty") << QByteArray();
+    QTest::newRow("whitespace") << QByteArray("  ");
+    QTest::newRow("invalid literal") << QByteArray("tru");
+    QTest::newRow("sign only") << QByteArray("-");
+    QTest::newRow("missing fraction") << QByteArray("1.");
+    QTest::newRow("missing exponent") << QByteArray("1e");
+    QTest::newRow("leading zero") << QByteArray("01");
+    QTest::newRow("out of range") << QByteArray("1e999");
+    QTest::newRow("unterminated string") << QByteArray("\"abc");
+    QTest::newRow("invalid escape") << QByteArray("\"\\x\"");
+    QTest::newRow("invalid unicode escape") << QByteArray("\"\\u12g4\"");
+    QTest::newRow("control character") << QByteArray("\"a\nb\"");
+    QTest::newRow("invalid UTF-8 byte") << QByteArray("\"a\xff" "b\"");
+    QTest::newRow("UTF-8 continuation byte") << QByteArray("\"a\x80" "b\"");
+    QTest::newRow("truncated UTF-8") << QByteArray("\"a\xe2\x82\"");
+    QTest::newRow("overlong UTF-8") << QByteArray("\"\xc0\xaf\"");
+    QTest::newRow("UTF-8 surrogate") << QByteArray("\"\xed\xa0\x80\"");
+    QTest::newRow("invalid UTF-8 in array") << QByteArray("[\"\xff\"]");
+    QTest::newRow("unterminated array") << QByteArray("[1,");
+    QTest::newRow("missing value separator") << QByteArray("[1 2]");
+    QTest::newRow("trailing comma in array") << QByteArray("[1,]");
+    QTest::newRow("missing name separator") << QByteArray("{\"a\" 1}");
+    QTest::newRow("trailing comma in object") << QByteArray("{\"a\": 1,}");
+    QTest::newRow("unquoted name") << QByteArray("{a: 1}");
+    QTest::newRow("garbage at end") << QByteArray("[1]]");
+    QTest::newRow("too deep") << QByteArray(2000, '[');
+}
+
+// Test: reading of members ------------------------------------------------------------------------
+
+void TestJsonStreamReader::testReadMembers()
+{
+    const QByteArray json("{\"b\": 1, \"a\": {\"x\": [1, {\"y\": 2}]}, \"c\": \"text\", \"d\": {}}");
+    JsonStreamReader reader(json);
+
+    QCOMPARE(reader.peekType(), QJsonValue::Object);
+    QVERIFY(reader.beginObject());
+
+    // Members are read in the order in which they are in the data
+    QStringList names;
+    QString name;
+
+    while (reader.nextMember(&name))
+    {
+        names.append(name);
+
+        if (name == QStringLiteral("a"))
+        {
+            QCOMPARE(reader.peekType(), QJsonValue::Object);
+            QVERIFY(reader.skipValue());
+        }
+        else if (name == QStringLiteral("d"))
+        {
+            // Nested object read member by member
+            QVERIFY(reader.beginObject());
+            QVERIFY(!reader.nextMember(&name));
+            QVERIFY(!reader.hasError());
+        }
+        else
+        {
+            const QJsonValue value = reader.readValue();
+            QVERIFY(!value.isUndefined());
+
+            if (name == QStringLiteral("b"))
+            {
+                QCOMPARE(value, QJsonValue(1));
+            }
+            else
+            {
+                QCOMPARE(value, QJsonValue(QStringLiteral("text")));
+            }
+        }
+    }
+
+    QVERIFY(!reader.hasError());
+    QVERIFY(reader.readEnd());
+    QCOMPARE(names, QStringList({"b", "a", "c", "d"}));
+}
+
+// Test: setOffset() method ------------------------------------------------------------------------
+
+void TestJsonStreamReader::testSetOffset()
+{
+    const QByteArray json("{\"config\": {\"a\": [1, 2]}, \"other\": true}");
+    JsonStreamReader reader(json);
+
+    // Skip the 'config' member and remember its position
+    QVERIFY(reader.beginObject());
+
+    int configOffset = -1;
+    QString name;
+
+    while (reader.nextMember(&name))
+    {
+        if (name == QStringLiteral("config"))
+        {
+            configOffset = reader.offset();
+        }
+
+        QVERIFY(reader.skipValue());
+    }
+
+    QVERIFY(reader.readEnd());
+    QVERIFY(configOffset > 0);
+
+    // Read the 'config' member
+    reader.setOffset(configOffset);
+    QCOMPARE(reader.readValue(), QJsonValue(QJsonObject {{ "a", QJsonArray {1, 2} }}));
+    QVERIFY(!reader.hasError());
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestJsonStreamReader)
+#include "testJsonStreamReader.moc"
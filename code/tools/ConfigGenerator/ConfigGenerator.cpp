@@ -0,0 +1,378 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for generating synthetic configuration files
+ */
+
+// Own header
+#include "ConfigGenerator.hpp"
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFrameworkTools
+{
+
+QJsonObject ConfigGeneratorParameters::toJson() const
+{
+    return QJsonObject {
+        { QStringLiteral("members"), members },
+        { QStringLiteral("depth"), depth },
+        { QStringLiteral("references"), references },
+        { QStringLiteral("derived_objects"), derivedObjects },
+        { QStringLiteral("bases_per_derived_object"), basesPerDerivedObject },
+        { QStringLiteral("environment_values"), environmentValues },
+        { QStringLiteral("include_chains"), includeChains },
+        { QStringLiteral("include_chain_length"), includeChainLength },
+        { QStringLiteral("integer_values"), integerValues },
+        { QStringLiteral("seed"), static_cast<double>(seed) }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigGenerator::ConfigGenerator(const ConfigGeneratorParameters &parameters)
+    : m_parameters(parameters),
+      m_nodeCount(0)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigGenerator::mainFileName()
+{
+    return QStringLiteral("config.json");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::map<QString, QJsonObject> ConfigGenerator::generate()
+{
+    reset();
+    std::map<QString, QJsonObject> files;
+
+    // Include chains need to be generated first so that the main configuration file can reference
+    // their nodes
+    for (int chain = 0; chain < m_parameters.includeChains; chain++)
+    {
+        for (int level = 0; level < m_parameters.includeChainLength; level++)
+        {
+            files.emplace(includeFileName(chain, level), createIncludeFile(chain, level));
+        }
+    }
+
+    files.emplace(mainFileName(), createMainFile());
+    return files;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::generateTree()
+{
+    reset();
+    return createTree(m_parameters.depth, QString());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigGenerator::writeFiles(const QDir &directory)
+{
+    const auto files = generate();
+
+    for (const auto &item : files)
+    {
+        QFile file(directory.absoluteFilePath(item.first));
+
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            return false;
+        }
+
+        const QByteArray data = QJsonDocument(item.second).toJson(QJsonDocument::Indented);
+
+        if (file.write(data) != static_cast<qint64>(data.size()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigGenerator::nodeCount() const
+{
+    return m_nodeCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigGenerator::valuePaths() const
+{
+    return m_valuePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigGenerator::reset()
+{
+    m_random.seed(m_parameters.seed);
+    m_objectPaths.clear();
+    m_valuePaths.clear();
+    m_nodeCount = 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::createTree(const int depth, const QString &nodePath)
+{
+    QJsonObject object;
+
+    if (depth == 0)
+    {
+        m_objectPaths.append(nodePath);
+    }
+
+    for (int i = 0; i < m_parameters.members; i++)
+    {
+        if (depth > 0)
+        {
+            const QString name = QString("node_%1").arg(i);
+            object.insert(name, createTree(depth - 1, nodePath + QChar('/') + name));
+        }
+        else
+        {
+            const QString name = QString("value_%1").arg(i);
+            object.insert(name, createValue());
+            m_valuePaths.append(nodePath + QChar('/') + name);
+        }
+
+        m_nodeCount++;
+    }
+
+    return object;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonValue ConfigGenerator::createValue()
+{
+    const int number = randomIndex(1000000);
+
+    if (m_parameters.integerValues)
+    {
+        return QJsonValue(number);
+    }
+
+    switch (randomIndex(4))
+    {
+        case 0:
+        {
+            return QJsonValue(number % 2 == 0);
+        }
+
+        case 1:
+        {
+            return QJsonValue(static_cast<double>(number) / 1000.0);
+        }
+
+        case 2:
+        {
+            return QJsonValue(QString("text_%1").arg(number));
+        }
+
+        default:
+        {
+            return QJsonValue(number);
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::createIncludeFile(const int chain, const int level)
+{
+    QJsonArray includes;
+
+    if ((level + 1) < m_parameters.includeChainLength)
+    {
+        includes.append(QJsonObject {
+                            { QStringLiteral("file_path"), includeFileName(chain, level + 1) }
+                        });
+    }
+
+    const QString levelName = QString("level_%1").arg(level);
+    const QString levelPath = QString("/included/chain_%1/%2").arg(chain).arg(levelName);
+
+    m_nodeCount++;
+
+    return QJsonObject {
+        { QStringLiteral("includes"), includes },
+        { QStringLiteral("config"), QJsonObject {
+              { levelName, createTree(m_parameters.depth, levelPath) }
+          }
+        }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::createMainFile()
+{
+    QJsonObject rootObject;
+    QJsonObject config;
+
+    // Includes
+    QJsonArray includes;
+
+    for (int chain = 0; chain < m_parameters.includeChains; chain++)
+    {
+        includes.append(QJsonObject {
+                            { QStringLiteral("file_path"), includeFileName(chain, 0) },
+                            { QStringLiteral("destination_node"),
+                              QString("/included/chain_%1").arg(chain) }
+                        });
+    }
+
+    rootObject.insert(QStringLiteral("includes"), includes);
+
+    // Tree
+    config.insert(QStringLiteral("tree"), createTree(m_parameters.depth, QStringLiteral("/tree")));
+    m_nodeCount++;
+
+    // Environment variables
+    if (m_parameters.environmentValues > 0)
+    {
+        QJsonObject environmentVariables;
+        QJsonObject environment;
+
+        for (int i = 0; i < m_parameters.environmentValues; i++)
+        {
+            const QString variableName = QString("CPPCONFIGFRAMEWORK_GENERATOR_VAR_%1").arg(i);
+
+            environmentVariables.insert(variableName, QString("value_%1").arg(i));
+            environment.insert(QString("$value_%1").arg(i),
+                               QString("prefix/${%1}/suffix").arg(variableName));
+            m_nodeCount++;
+        }
+
+        rootObject.insert(QStringLiteral("environment_variables"), environmentVariables);
+        config.insert(QStringLiteral("environment"), environment);
+        m_nodeCount++;
+    }
+
+    // Derived objects
+    QStringList derivedPaths;
+
+    if (m_parameters.derivedObjects > 0)
+    {
+        QJsonObject derived;
+
+        for (int i = 0; i < m_parameters.derivedObjects; i++)
+        {
+            QJsonArray bases;
+
+            for (int j = 0; j < m_parameters.basesPerDerivedObject; j++)
+            {
+                // Derive also from previously declared DerivedObject nodes to create dependency
+                // chains between them
+                if ((!derivedPaths.isEmpty()) && (randomIndex(4) == 0))
+                {
+                    bases.append(derivedPaths.at(randomIndex(derivedPaths.size())));
+                }
+                else
+                {
+                    bases.append(m_objectPaths.at(randomIndex(m_objectPaths.size())));
+                }
+            }
+
+            derived.insert(QString("&derived_%1").arg(i),
+                           QJsonObject {
+                               { QStringLiteral("base"), bases },
+                               { QStringLiteral("config"), QJsonObject {
+                                     { QStringLiteral("derived_index"), i }
+                                 }
+                               }
+                           });
+            derivedPaths.append(QString("/derived/derived_%1").arg(i));
+            m_nodeCount++;
+        }
+
+        config.insert(QStringLiteral("derived"), derived);
+        m_nodeCount++;
+    }
+
+    // References
+    if (m_parameters.references > 0)
+    {
+        QJsonObject references;
+
+        for (int i = 0; i < m_parameters.references; i++)
+        {
+            QString target;
+
+            if ((!derivedPaths.isEmpty()) && (randomIndex(4) == 0))
+            {
+                target = derivedPaths.at(randomIndex(derivedPaths.size()));
+            }
+            else
+            {
+                target = m_valuePaths.at(randomIndex(m_valuePaths.size()));
+            }
+
+            references.insert(QString("&ref_%1").arg(i), target);
+            m_nodeCount++;
+        }
+
+        config.insert(QStringLiteral("references"), references);
+        m_nodeCount++;
+    }
+
+    rootObject.insert(QStringLiteral("config"), config);
+    return rootObject;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigGenerator::randomIndex(const int count)
+{
+    // The output of std::mt19937 is fully specified by the standard (unlike the distributions) so
+    // the generated configuration is the same on all platforms
+    return static_cast<int>(m_random() % static_cast<quint32>(count));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigGenerator::includeFileName(const int chain, const int level)
+{
+    return QString("include_%1_%2.json").arg(chain).arg(level);
+}
+
+} // namespace CppConfigFrameworkTools
@@ -0,0 +1,239 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for generating synthetic configuration files
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QDir>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+
+// System includes
+#include <map>
+#include <random>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFrameworkTools
+{
+
+//! Holds the parameters of the generated configuration
+struct ConfigGeneratorParameters
+{
+    //! Number of members in each Object node of the generated trees
+    int members = 4;
+
+    //! Number of Object node levels in the generated trees
+    int depth = 3;
+
+    //! Number of NodeReference nodes (placed in the "/references" node)
+    int references = 0;
+
+    //! Number of DerivedObject nodes (placed in the "/derived" node)
+    int derivedObjects = 0;
+
+    //! Number of entries in the 'base' member of each DerivedObject node
+    int basesPerDerivedObject = 2;
+
+    //! Number of Value nodes with references to environment variables (placed in "/environment")
+    int environmentValues = 0;
+
+    //! Number of include chains (each chain is placed in the "/included/chain_<index>" node)
+    int includeChains = 0;
+
+    //! Number of configuration files in each include chain
+    int includeChainLength = 1;
+
+    //! Generate only integer Value nodes (otherwise the Value nodes have random types)
+    bool integerValues = false;
+
+    //! Seed for the random number generator
+    quint32 seed = 0U;
+
+    /*!
+     * Converts the parameters to a JSON Object
+     *
+     * \return  JSON Object
+     */
+    QJsonObject toJson() const;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class generates synthetic configuration files
+ *
+ * The generated configuration consists of the main configuration file (mainFileName()) and the
+ * included configuration files. The same parameters (including the seed) always produce the same
+ * configuration files.
+ *
+ * Structure of the main configuration file:
+ * - "/tree": Object nodes named "node_<index>" with Value nodes named "value_<index>" on the last
+ *   level
+ * - "/environment": Value nodes ('$' decorator) which reference the environment variables declared
+ *   in the 'environment_variables' member
+ * - "/derived": DerivedObject nodes which are derived from random Object nodes on the last level of
+ *   the trees and from the previously declared DerivedObject nodes
+ * - "/references": NodeReference nodes which reference random Value nodes of the trees and
+ *   DerivedObject nodes
+ * - "/included": trees from the include chains, each file in the chain includes the next one
+ */
+class ConfigGenerator
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   parameters  Parameters of the generated configuration
+     */
+    explicit ConfigGenerator(const ConfigGeneratorParameters &parameters);
+
+    /*!
+     * Returns the name of the main configuration file
+     *
+     * \return  File name
+     */
+    static QString mainFileName();
+
+    /*!
+     * Generates the configuration files
+     *
+     * \return  Map of file names to their contents
+     */
+    std::map<QString, QJsonObject> generate();
+
+    /*!
+     * Generates just a tree of Object and Value nodes (without the rest of the configuration)
+     *
+     * \return  JSON Object
+     *
+     * The tree has the same structure as the "/tree" node of the main configuration file. This is
+     * useful for creating configuration nodes directly, without reading a configuration file.
+     */
+    QJsonObject generateTree();
+
+    /*!
+     * Generates the configuration files and writes them to the specified directory
+     *
+     * \param   directory   Output directory
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool writeFiles(const QDir &directory);
+
+    /*!
+     * Returns the number of configuration nodes declared in the last generated configuration
+     *
+     * \return  Number of configuration nodes
+     */
+    int nodeCount() const;
+
+    /*!
+     * Returns the node paths of the Value nodes in the trees of the last generated configuration
+     *
+     * \return  Absolute node paths
+     *
+     * \note    After generateTree() the node paths are relative to the root of the generated tree
+     *          (for example "/node_0/value_0")
+     */
+    QStringList valuePaths() const;
+
+private:
+    //! Resets the random number generator and the information about the generated configuration
+    void reset();
+
+    /*!
+     * Generates an Object node and its members
+     *
+     * \param   depth       Number of remaining Object node levels
+     * \param   nodePath    Node path of the generated Object node (after all includes are applied)
+     *
+     * \return  JSON Object
+     */
+    QJsonObject createTree(const int depth, const QString &nodePath);
+
+    /*!
+     * Generates a random JSON value for a Value node
+     *
+     * \return  JSON value
+     */
+    QJsonValue createValue();
+
+    /*!
+     * Generates a file in the include chain
+     *
+     * \param   chain   Index of the include chain
+     * \param   level   Index of the file in the include chain
+     *
+     * \return  JSON Object
+     */
+    QJsonObject createIncludeFile(const int chain, const int level);
+
+    /*!
+     * Generates the main configuration file
+     *
+     * \return  JSON Object
+     */
+    QJsonObject createMainFile();
+
+    /*!
+     * Returns a random integer in the specified range
+     *
+     * \param   count   Number of possible values
+     *
+     * \return  Random integer in range [0, count)
+     */
+    int randomIndex(const int count);
+
+    /*!
+     * Returns the name of the file in the include chain
+     *
+     * \param   chain   Index of the include chain
+     * \param   level   Index of the file in the include chain
+     *
+     * \return  File name
+     */
+    static QString includeFileName(const int chain, const int level);
+
+private:
+    //! Holds the parameters of the generated configuration
+    ConfigGeneratorParameters m_parameters;
+
+    //! Holds the random number generator
+    std::mt19937 m_random;
+
+    //! Holds the node paths of Object nodes on the last level of the generated trees
+    QStringList m_objectPaths;
+
+    //! Holds the node paths of Value nodes of the generated trees
+    QStringList m_valuePaths;
+
+    //! Holds the number of generated configuration nodes
+    int m_nodeCount;
+};
+
+} // namespace CppConfigFrameworkTools
@@ -0,0 +1,208 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the command line application for generating synthetic configuration files
+ */
+
+// C++ Config Framework includes
+#include "ConfigGenerator.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDebug>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFrameworkTools;
+
+/*!
+ * Reads an integer option from the command line parser
+ *
+ * \param   parser          Command line parser
+ * \param   option          Command line option
+ * \param   minimumValue    Minimum allowed value
+ *
+ * \param[in,out]   value   Output for the option value (unchanged if option is not set)
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool readIntegerOption(const QCommandLineParser &parser,
+                              const QCommandLineOption &option,
+                              const int minimumValue,
+                              int *value)
+{
+    if (!parser.isSet(option))
+    {
+        return true;
+    }
+
+    bool ok = false;
+    const int optionValue = parser.value(option).toInt(&ok);
+
+    if ((!ok) || (optionValue < minimumValue))
+    {
+        qWarning().noquote() << QString("Invalid value [%1] for option [%2], minimum value is %3")
+                                .arg(parser.value(option), option.names().first())
+                                .arg(minimumValue);
+        return false;
+    }
+
+    *value = optionValue;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                QStringLiteral("Generates synthetic C++ Config Framework configuration files"));
+    parser.addHelpOption();
+
+    const QCommandLineOption outputDirOption(
+                QStringLiteral("output-dir"),
+                QStringLiteral("Output directory for the configuration files (required)"),
+                QStringLiteral("dir"));
+    const QCommandLineOption membersOption(
+                QStringLiteral("members"),
+                QStringLiteral("Number of members in each Object node (default: 4)"),
+                QStringLiteral("count"));
+    const QCommandLineOption depthOption(
+                QStringLiteral("depth"),
+                QStringLiteral("Number of Object node levels (default: 3)"),
+                QStringLiteral("count"));
+    const QCommandLineOption referencesOption(
+                QStringLiteral("references"),
+                QStringLiteral("Number of NodeReference nodes (default: 0)"),
+                QStringLiteral("count"));
+    const QCommandLineOption derivedObjectsOption(
+                QStringLiteral("derived-objects"),
+                QStringLiteral("Number of DerivedObject nodes (default: 0)"),
+                QStringLiteral("count"));
+    const QCommandLineOption basesOption(
+                QStringLiteral("bases"),
+                QStringLiteral("Number of bases for each DerivedObject node (default: 2)"),
+                QStringLiteral("count"));
+    const QCommandLineOption environmentValuesOption(
+                QStringLiteral("environment-values"),
+                QStringLiteral("Number of Value nodes with references to environment variables "
+                               "(default: 0)"),
+                QStringLiteral("count"));
+    const QCommandLineOption includeChainsOption(
+                QStringLiteral("include-chains"),
+                QStringLiteral("Number of include chains (default: 0)"),
+                QStringLiteral("count"));
+    const QCommandLineOption includeChainLengthOption(
+                QStringLiteral("include-chain-length"),
+                QStringLiteral("Number of configuration files in each include chain (default: 1)"),
+                QStringLiteral("count"));
+    const QCommandLineOption integerValuesOption(
+                QStringLiteral("integer-values"),
+                QStringLiteral("Generate only integer Value nodes (default: random value types)"));
+    const QCommandLineOption seedOption(
+                QStringLiteral("seed"),
+                QStringLiteral("Seed for the random number generator (default: 0)"),
+                QStringLiteral("value"));
+
+    parser.addOption(outputDirOption);
+    parser.addOption(membersOption);
+    parser.addOption(depthOption);
+    parser.addOption(referencesOption);
+    parser.addOption(derivedObjectsOption);
+    parser.addOption(basesOption);
+    parser.addOption(environmentValuesOption);
+    parser.addOption(includeChainsOption);
+    parser.addOption(includeChainLengthOption);
+    parser.addOption(integerValuesOption);
+    parser.addOption(seedOption);
+
+    parser.process(app);
+
+    // Read parameters
+    if (!parser.isSet(outputDirOption))
+    {
+        qWarning() << "The output directory is not set";
+        return 1;
+    }
+
+    ConfigGeneratorParameters parameters;
+
+    if ((!readIntegerOption(parser, membersOption, 1, &parameters.members)) ||
+        (!readIntegerOption(parser, depthOption, 0, &parameters.depth)) ||
+        (!readIntegerOption(parser, referencesOption, 0, &parameters.references)) ||
+        (!readIntegerOption(parser, derivedObjectsOption, 0, &parameters.derivedObjects)) ||
+        (!readIntegerOption(parser, basesOption, 1, &parameters.basesPerDerivedObject)) ||
+        (!readIntegerOption(parser,
+                            environmentValuesOption,
+                            0,
+                            &parameters.environmentValues)) ||
+        (!readIntegerOption(parser, includeChainsOption, 0, &parameters.includeChains)) ||
+        (!readIntegerOption(parser,
+                            includeChainLengthOption,
+                            1,
+                            &parameters.includeChainLength)))
+    {
+        return 1;
+    }
+
+    parameters.integerValues = parser.isSet(integerValuesOption);
+
+    if (parser.isSet(seedOption))
+    {
+        bool ok = false;
+        parameters.seed = parser.value(seedOption).toUInt(&ok);
+
+        if (!ok)
+        {
+            qWarning() << "Invalid seed:" << parser.value(seedOption);
+            return 1;
+        }
+    }
+
+    // Generate configuration files
+    QDir outputDir(parser.value(outputDirOption));
+
+    if (!outputDir.mkpath(QStringLiteral(".")))
+    {
+        qWarning() << "Failed to create the output directory:" << outputDir.absolutePath();
+        return 1;
+    }
+
+    ConfigGenerator generator(parameters);
+
+    if (!generator.writeFiles(outputDir))
+    {
+        qWarning() << "Failed to write the configuration files to:" << outputDir.absolutePath();
+        return 1;
+    }
+
+    qInfo().noquote() << QString("Generated configuration with %1 nodes: %2")
+                         .arg(generator.nodeCount())
+                         .arg(outputDir.absoluteFilePath(ConfigGenerator::mainFileName()));
+    return 0;
+}